@@ -36,6 +36,7 @@
 # include <boost/scope_exit.hpp>
 # include <algorithm>
 # include <functional>
+# include <limits>
 # include <cerrno>
 # if defined(_WIN32) && !(defined(__MINGW32__) or defined(__MINGW64__))
 #   include <sys/timeb.h>
@@ -1055,6 +1056,77 @@ openvrml::node_metatype_registry::register_node_metatype(
  * @c openvrml_register_node_metatypes.
  */
 
+/**
+ * @class openvrml::event_cascade_stats openvrml/browser.h
+ *
+ * @brief Statistics about the event cascades processed by a @c browser.
+ *
+ * An event cascade is the set of events that result, directly or
+ * indirectly, from a single event emitted outside of any cascade.
+ *
+ * @sa openvrml::browser::event_cascade_stats
+ */
+
+/**
+ * @var size_t openvrml::event_cascade_stats::cascades
+ *
+ * @brief The number of cascades processed.
+ */
+
+/**
+ * @var size_t openvrml::event_cascade_stats::events
+ *
+ * @brief The number of events delivered, summed over all cascades.
+ */
+
+/**
+ * @var size_t openvrml::event_cascade_stats::dropped_events
+ *
+ * @brief The number of events dropped because their @c eventOut had already
+ *        emitted an event with the same timestamp.
+ */
+
+/**
+ * @var size_t openvrml::event_cascade_stats::last_depth
+ *
+ * @brief The depth of the most recent cascade.
+ *
+ * The event that starts a cascade is at depth 1; events emitted in response
+ * to an event at depth @e n are at depth <var>n</var> + 1.
+ */
+
+/**
+ * @var size_t openvrml::event_cascade_stats::last_size
+ *
+ * @brief The number of events delivered in the most recent cascade.
+ */
+
+/**
+ * @var size_t openvrml::event_cascade_stats::max_depth
+ *
+ * @brief The greatest depth of any cascade.
+ */
+
+/**
+ * @var size_t openvrml::event_cascade_stats::max_size
+ *
+ * @brief The greatest number of events delivered in any cascade.
+ */
+
+/**
+ * @brief Construct.
+ */
+openvrml::event_cascade_stats::event_cascade_stats() OPENVRML_NOTHROW:
+    cascades(0),
+    events(0),
+    dropped_events(0),
+    last_depth(0),
+    last_size(0),
+    max_depth(0),
+    max_size(0)
+{}
+
+
 /**
  * @class openvrml::browser openvrml/browser.h
  *
@@ -1290,9 +1362,33 @@ openvrml::node_metatype_registry::register_node_metatype(
 /**
  * @internal
  *
- * @var std::list<openvrml::time_dependent_node *> openvrml::browser::timers_
+ * @typedef openvrml::browser::wakeup
  *
- * @brief A list of all the TimeSensor @c node%s in the @c browser.
+ * @brief A time paired with the @c time_dependent_node that is due to be
+ *        updated at that time.
+ */
+
+/**
+ * @internal
+ *
+ * @var std::map<openvrml::time_dependent_node *, double> openvrml::browser::timers_
+ *
+ * @brief The time-dependent @c node%s in the @c browser, each mapped to the
+ *        time at which it is due to be updated.
+ *
+ * A @c node that is being updated is mapped to NaN.
+ */
+
+/**
+ * @internal
+ *
+ * @var std::priority_queue<openvrml::browser::wakeup, std::vector<openvrml::browser::wakeup>, std::greater<openvrml::browser::wakeup> > openvrml::browser::wakeups_
+ *
+ * @brief Pending updates, earliest first.
+ *
+ * An entry is stale, and is discarded when it reaches the top, unless its
+ * @c node is still in @c #timers_ and mapped to the same time.  So
+ * rescheduling a @c node does not require finding its old entry.
  */
 
 /**
@@ -1443,15 +1539,115 @@ double openvrml::browser::current_time() OPENVRML_NOTHROW
  */
 
 /**
- * @var bool openvrml::browser::flags_need_updating
+ * @internal
+ *
+ * @var boost::thread_specific_ptr<openvrml::browser::event_cascade> openvrml::browser::event_cascade_
+ *
+ * @brief The event cascade being processed on the current thread, if any.
+ */
+
+/**
+ * @internal
+ *
+ * @var const boost::scoped_ptr<openvrml::browser::event_cascade_counters> openvrml::browser::event_cascade_counters_
+ *
+ * @brief Event cascade statistics.
+ */
+
+/**
+ * @internal
+ *
+ * @brief The queue of pending events for an event cascade.
+ *
+ * Events are delivered breadth-first: an event emitted while delivering
+ * another is appended to the queue rather than delivered immediately.
+ *
+ * There is one @c event_cascade per thread; it is reused from one cascade to
+ * the next so that its storage is only allocated once.
+ */
+struct OPENVRML_LOCAL openvrml::browser::event_cascade : boost::noncopyable {
+    struct queued_event {
+        boost::intrusive_ptr<node> source;
+        event_emitter * emitter;
+        double timestamp;
+        size_t depth;
+    };
+
+    std::vector<queued_event> queue;
+    size_t head;
+    size_t depth;
+    bool active;
+
+    event_cascade():
+        head(0),
+        depth(0),
+        active(false)
+    {}
+
+    void push(event_emitter & emitter, node & source, double timestamp)
+        OPENVRML_THROW1(std::bad_alloc);
+};
+
+/**
+ * @brief Add an event to the queue.
  *
- * @brief Set by @c node::bounding_volume_dirty on any node in this browser
- *        graph, cleared by @c #update_flags.
+ * @param[in,out] emitter   the @c event_emitter.
+ * @param[in]     source    the @c node that owns @p emitter.
+ * @param[in]     timestamp the timestamp of the event.
  *
- * @c true if the bvolume dirty flag has been set on a @c node in the
- * @c browser graph, but has not yet been propagated to that
- * <code>node</code>'s ancestors.
+ * @exception std::bad_alloc    if memory allocation fails.
  */
+void openvrml::browser::event_cascade::push(event_emitter & emitter,
+                                            node & source,
+                                            const double timestamp)
+    OPENVRML_THROW1(std::bad_alloc)
+{
+    const queued_event event = {
+        boost::intrusive_ptr<node>(&source),
+        &emitter,
+        timestamp,
+        this->depth + 1
+    };
+    this->queue.push_back(event);
+}
+
+/**
+ * @internal
+ *
+ * @brief The counters behind @c browser::event_cascade_stats.
+ *
+ * The counters are updated once per cascade; they are atomic so that this
+ * does not require a lock.
+ */
+struct OPENVRML_LOCAL openvrml::browser::event_cascade_counters :
+    boost::noncopyable {
+
+    boost::atomic<size_t> cascades;
+    boost::atomic<size_t> events;
+    boost::atomic<size_t> dropped_events;
+    boost::atomic<size_t> last_depth;
+    boost::atomic<size_t> last_size;
+    boost::atomic<size_t> max_depth;
+    boost::atomic<size_t> max_size;
+
+    event_cascade_counters():
+        cascades(0),
+        events(0),
+        dropped_events(0),
+        last_depth(0),
+        last_size(0),
+        max_depth(0),
+        max_size(0)
+    {}
+
+    static void update_max(boost::atomic<size_t> & max, const size_t value)
+        OPENVRML_NOTHROW
+    {
+        size_t current = max.load();
+        while (current < value && !max.compare_exchange_weak(current, value))
+        {}
+    }
+};
 
 /**
  * @brief Constructor.
@@ -1484,7 +1680,7 @@ openvrml::browser::browser(resource_fetcher & fetcher,
     frame_rate_(0.0),
     out_(&out),
     err_(&err),
-    flags_need_updating(false)
+    event_cascade_counters_(new event_cascade_counters)
 {
     assert(this->active_viewpoint_);
     assert(this->active_navigation_info_);
@@ -2278,6 +2474,108 @@ double openvrml::browser::frame_rate() const
     return this->frame_rate_;
 }
 
+/**
+ * @brief Get statistics about the event cascades processed by the
+ *        @c browser.
+ *
+ * @return statistics about the event cascades processed by the @c browser.
+ */
+const openvrml::event_cascade_stats
+openvrml::browser::event_cascade_stats() const
+{
+    const event_cascade_counters & counters = *this->event_cascade_counters_;
+    openvrml::event_cascade_stats stats;
+    stats.cascades = counters.cascades;
+    stats.events = counters.events;
+    stats.dropped_events = counters.dropped_events;
+    stats.last_depth = counters.last_depth;
+    stats.last_size = counters.last_size;
+    stats.max_depth = counters.max_depth;
+    stats.max_size = counters.max_size;
+    return stats;
+}
+
+/**
+ * @brief Queue an event for delivery.
+ *
+ * This function is called by @c node::emit_event.
+ *
+ * An @c eventOut emits at most one event per timestamp; if @p emitter has
+ * already emitted an event with @p timestamp, the event is dropped.  This
+ * breaks routing loops.
+ *
+ * If an event cascade is already being processed on the current thread, the
+ * event is appended to its queue and will be delivered once the events
+ * ahead of it have been.  Otherwise, a new cascade is started with this
+ * event, and it is processed to completion before this function returns.
+ *
+ * A queued event is delivered with the value @p emitter has when the event
+ * reaches the front of the queue, not the value it had when the event was
+ * queued.  These can differ only if the field is set again, later in the
+ * same cascade, by an event whose own emission is then dropped; the
+ * listeners receive the last value set.
+ *
+ * @param[in,out] emitter   the @c event_emitter.
+ * @param[in]     source    the @c node that owns @p emitter.
+ * @param[in]     timestamp the timestamp of the event.
+ *
+ * @exception std::bad_alloc    if memory allocation fails.
+ */
+void openvrml::browser::queue_event(event_emitter & emitter,
+                                    node & source,
+                                    const double timestamp)
+    OPENVRML_THROW1(std::bad_alloc)
+{
+    event_cascade_counters & counters = *this->event_cascade_counters_;
+
+    if (emitter.cascade_time_.exchange(timestamp) == timestamp) {
+        ++counters.dropped_events;
+        return;
+    }
+
+    event_cascade * cascade = this->event_cascade_.get();
+    if (!cascade) {
+        cascade = new event_cascade;
+        this->event_cascade_.reset(cascade);
+    }
+
+    if (cascade->active) {
+        cascade->push(emitter, source, timestamp);
+        return;
+    }
+
+    //
+    // Start a new cascade.  The first event can be delivered immediately;
+    // the queue is empty, so there is nothing that should precede it.
+    //
+    cascade->active = true;
+    BOOST_SCOPE_EXIT((cascade)) {
+        cascade->queue.clear();
+        cascade->head = 0;
+        cascade->depth = 0;
+        cascade->active = false;
+    } BOOST_SCOPE_EXIT_END
+
+    cascade->depth = 1;
+    emitter.emit_event(timestamp);
+    size_t size = 1, max_depth = 1;
+    while (cascade->head < cascade->queue.size()) {
+        const event_cascade::queued_event event =
+            cascade->queue[cascade->head++];
+        cascade->depth = event.depth;
+        max_depth = (std::max)(max_depth, event.depth);
+        ++size;
+        event.emitter->emit_event(event.timestamp);
+    }
+
+    ++counters.cascades;
+    counters.events += size;
+    counters.last_depth = max_depth;
+    counters.last_size = size;
+    event_cascade_counters::update_max(counters.max_depth, max_depth);
+    event_cascade_counters::update_max(counters.max_size, size);
+}
+
 /**
  * Called by the @c viewer when the cursor passes over, clicks, drags, or
  * releases a sensitive object (an Anchor or another grouping node with
@@ -2314,32 +2612,67 @@ void openvrml::browser::sensitive_event(node * const n,
  *
  * This method should be called after each frame is rendered.
  *
+ * Only the <code>time_dependent_node</code>s that are due (see
+ * @c time_dependent_node::next_update_time) are updated; idle ones cost
+ * nothing.  Afterward, @c #delta is no greater than the time remaining until
+ * @c #next_wakeup_time.
+ *
  * @return @c true if the @c browser needs to be rerendered, @c false otherwise.
  */
 bool openvrml::browser::update(double current_time)
 {
     using std::for_each;
     using boost::shared_lock;
+    using boost::unique_lock;
     using boost::shared_mutex;
 
-    shared_lock<shared_mutex>
-        timers_lock(this->timers_mutex_),
-        scripts_lock(this->scripts_mutex_);
-
     if (current_time <= 0.0) { current_time = browser::current_time(); }
 
     this->delta_time = DEFAULT_DELTA;
 
     //
-    // Update each of the timers.
+    // The due nodes are updated without holding timers_mutex_: the events
+    // they emit may add, remove or reschedule time-dependent nodes.
     //
-    for_each(this->timers_.begin(), this->timers_.end(),
-             boost::bind2nd(boost::mem_fun(&time_dependent_node::update),
-                            current_time));
+    typedef std::vector<boost::intrusive_ptr<time_dependent_node> > due_t;
+    due_t due;
+    {
+        unique_lock<shared_mutex> timers_lock(this->timers_mutex_);
+        while (!this->wakeups_.empty()
+               && this->wakeups_.top().first <= current_time) {
+            const wakeup next = this->wakeups_.top();
+            this->wakeups_.pop();
+            const std::map<time_dependent_node *, double>::iterator pos =
+                this->timers_.find(next.second);
+            if (pos == this->timers_.end() || pos->second != next.first) {
+                continue;
+            }
+            pos->second = std::numeric_limits<double>::quiet_NaN();
+            due.push_back(boost::intrusive_ptr<time_dependent_node>(
+                              next.second));
+        }
+    }
+
+    for (due_t::const_iterator n = due.begin(); n != due.end(); ++n) {
+        (*n)->update(current_time);
+    }
+
+    {
+        unique_lock<shared_mutex> timers_lock(this->timers_mutex_);
+        for (due_t::const_iterator n = due.begin(); n != due.end(); ++n) {
+            if (this->timers_.find(n->get()) != this->timers_.end()) {
+                this->schedule(**n);
+            }
+        }
+    }
+
+    const double wait = this->next_wakeup_time() - current_time;
+    this->delta(wait > 0.0 ? wait : 0.0);
 
     //
     // Update each of the scripts.
     //
+    shared_lock<shared_mutex> scripts_lock(this->scripts_mutex_);
     for_each(this->scripts_.begin(), this->scripts_.end(),
              boost::bind2nd(boost::mem_fun(&script_node::update),
                             current_time));
@@ -2598,9 +2931,8 @@ void openvrml::browser::add_time_dependent(time_dependent_node & n)
     using boost::unique_lock;
     using boost::shared_mutex;
     unique_lock<shared_mutex> lock(this->timers_mutex_);
-    assert(std::find(this->timers_.begin(), this->timers_.end(), &n)
-           == this->timers_.end());
-    this->timers_.push_back(&n);
+    assert(this->timers_.find(&n) == this->timers_.end());
+    this->schedule(n);
 }
 
 /**
@@ -2616,30 +2948,75 @@ openvrml::browser::remove_time_dependent(time_dependent_node & n)
     using boost::unique_lock;
     using boost::shared_mutex;
     unique_lock<shared_mutex> lock(this->timers_mutex_);
-    assert(!this->timers_.empty());
-    const std::list<time_dependent_node *>::iterator end = this->timers_.end();
-    const std::list<time_dependent_node *>::iterator pos =
-            std::find(this->timers_.begin(), end, &n);
-    assert(pos != end);
+    const std::map<time_dependent_node *, double>::iterator pos =
+        this->timers_.find(&n);
+    assert(pos != this->timers_.end());
     this->timers_.erase(pos);
 }
 
 /**
- * @brief Propagate the bvolume dirty flag from children to ancestors.
+ * @brief Recompute when a time-dependent node is next due to be updated.
+ *
+ * A @c time_dependent_node calls this (by way of
+ * @c time_dependent_node::reschedule) when an event makes its
+ * @c time_dependent_node::next_update_time earlier than it was.
+ *
+ * @param[in] n a @c time_dependent_node.
+ *
+ * @exception std::bad_alloc    if memory allocation fails.
+ */
+void openvrml::browser::reschedule(time_dependent_node & n)
+{
+    using boost::unique_lock;
+    using boost::shared_mutex;
+    unique_lock<shared_mutex> lock(this->timers_mutex_);
+    if (this->timers_.find(&n) != this->timers_.end()) { this->schedule(n); }
+}
+
+/**
+ * @brief The time at which the next @c #update has work to do.
+ *
+ * Hosts can sleep until this time (or until user input arrives) instead of
+ * polling.  Script @c node%s are not considered.
+ *
+ * @return the time at which a @c time_dependent_node is next due to be
+ *         updated, or infinity if none is.
+ */
+double openvrml::browser::next_wakeup_time()
+{
+    using boost::unique_lock;
+    using boost::shared_mutex;
+    unique_lock<shared_mutex> lock(this->timers_mutex_);
+    while (!this->wakeups_.empty()) {
+        const wakeup & next = this->wakeups_.top();
+        const std::map<time_dependent_node *, double>::const_iterator pos =
+            this->timers_.find(next.second);
+        if (pos != this->timers_.end() && pos->second == next.first) {
+            return next.first;
+        }
+        this->wakeups_.pop();
+    }
+    return std::numeric_limits<double>::infinity();
+}
+
+/**
+ * @internal
  *
- * The invariant is that if a <code>node</code>'s bounding volume is out of
- * date, then the bounding volumes of all that <code>node</code>'s ancestors
- * must be out of date.  However, @c node does not maintain a parent pointer.
- * So we must do a traversal of the entire browser graph to do the
- * propagation.
+ * @brief Queue the next update of @p n.
  *
- * @see node::setBVolumeDirty
- * @see node::isBVolumeDirty
+ * @param[in] n a @c time_dependent_node.
+ *
+ * @pre The caller holds a unique lock on @c #timers_mutex_.
+ *
+ * @exception std::bad_alloc    if memory allocation fails.
  */
-void openvrml::browser::update_flags()
+void openvrml::browser::schedule(time_dependent_node & n)
 {
-//  Node* root = this->getRoot();
-//  root->updateModified(0x002);
+    const double time = n.next_update_time();
+    this->timers_[&n] = time;
+    if (time < std::numeric_limits<double>::infinity()) {
+        this->wakeups_.push(wakeup(time, &n));
+    }
 }
 
 /**
@@ -23,6 +23,7 @@
 #   define OPENVRML_BROWSER_H
 
 #   include <openvrml/script.h>
+#   include <queue>
 
 namespace openvrml {
 
@@ -173,6 +174,19 @@ namespace openvrml {
     typedef void (*register_node_metatypes_func)(node_metatype_registry &);
 
 
+    struct OPENVRML_API event_cascade_stats {
+        size_t cascades;
+        size_t events;
+        size_t dropped_events;
+        size_t last_depth;
+        size_t last_size;
+        size_t max_depth;
+        size_t max_size;
+
+        event_cascade_stats() OPENVRML_NOTHROW;
+    };
+
+
     class viewer;
     class scene;
 
@@ -193,6 +207,7 @@ namespace openvrml {
     }
 
     class OPENVRML_API browser : boost::noncopyable {
+        friend class node;
         friend class scene;
         friend class script_node;
         friend bool OPENVRML_API operator==(const node_type &,
@@ -200,6 +215,8 @@ namespace openvrml {
             OPENVRML_NOTHROW;
 
         struct root_scene_loader;
+        struct event_cascade;
+        struct event_cascade_counters;
         friend class local::externproto_node;
         friend class local::externproto_node_type;
         friend class local::externproto_node_metatype;
@@ -251,8 +268,12 @@ namespace openvrml {
         boost::shared_mutex scripts_mutex_;
         std::list<script_node *> scripts_;
 
+        typedef std::pair<double, time_dependent_node *> wakeup;
+
         boost::shared_mutex timers_mutex_;
-        std::list<time_dependent_node *> timers_;
+        std::map<time_dependent_node *, double> timers_;
+        std::priority_queue<wakeup, std::vector<wakeup>,
+                            std::greater<wakeup> > wakeups_;
 
         boost::shared_mutex listeners_mutex_;
         std::set<browser_listener *> listeners_;
@@ -277,11 +298,13 @@ namespace openvrml {
         mutable boost::mutex err_mutex_;
         std::ostream * const err_;
 
+        boost::thread_specific_ptr<event_cascade> event_cascade_;
+        const boost::scoped_ptr<event_cascade_counters>
+            event_cascade_counters_;
+
     public:
         static double current_time() OPENVRML_NOTHROW;
 
-        bool flags_need_updating;
-
         browser(resource_fetcher & fetcher,
                 std::ostream & out,
                 std::ostream & err)
@@ -342,6 +365,8 @@ namespace openvrml {
 
         double frame_rate() const;
 
+        const openvrml::event_cascade_stats event_cascade_stats() const;
+
         bool update(double current_time = -1.0);
 
         void render(rendering_context &context);
@@ -357,17 +382,24 @@ namespace openvrml {
 
         void add_time_dependent(time_dependent_node & n);
         void remove_time_dependent(time_dependent_node & n);
+        void reschedule(time_dependent_node & n);
+        double next_wakeup_time();
 
         void add_script(script_node &);
         void remove_script(script_node &);
 
-        void update_flags();
-
         void out(const std::string & str) const;
         void err(const std::string & str) const;
 
     protected:
         bool headlight_on();
+
+    private:
+        void schedule(time_dependent_node & n);
+
+        void queue_event(event_emitter & emitter, node & source,
+                         double timestamp)
+            OPENVRML_THROW1(std::bad_alloc);
     };
 }
 
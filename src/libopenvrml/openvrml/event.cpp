@@ -23,6 +23,7 @@
 # endif
 
 # include "event.h"
+# include <limits>
 
 /**
  * @file openvrml/event.h
@@ -409,6 +410,13 @@ const std::string openvrml::node_event_listener::eventin_id() const
  * of @c node should call @c node::emit_event to emit an event.
  */
 
+/**
+ * @var class openvrml::event_emitter::browser
+ *
+ * @brief @c browser::queue_event calls @c event_emitter::emit_event to
+ *        deliver queued events.
+ */
+
 /**
  * @internal
  *
@@ -445,7 +453,116 @@ const std::string openvrml::node_event_listener::eventin_id() const
 /**
  * @internal
  *
- * @var double openvrml::event_emitter::last_time_
+ * @class openvrml::event_emitter::listener_table
+ *
+ * @brief Base class for the compiled dispatch table of an @c event_emitter.
+ */
+
+/**
+ * @brief Destroy.
+ */
+openvrml::event_emitter::listener_table::~listener_table() OPENVRML_NOTHROW
+{}
+
+/**
+ * @internal
+ *
+ * @class openvrml::event_emitter::field_value_listener_table
+ *
+ * @brief The listeners of an @c event_emitter, already cast to the concrete
+ *        @c field_value_listener type.
+ *
+ * @tparam FieldValue   a @link FieldValueConcept Field Value@endlink.
+ */
+
+/**
+ * @typedef openvrml::event_emitter::field_value_listener_table::listener_vector
+ *
+ * @brief A sequence of @c field_value_listener%s.
+ */
+
+/**
+ * @var openvrml::event_emitter::field_value_listener_table::listener_vector openvrml::event_emitter::field_value_listener_table::listeners
+ *
+ * @brief The listeners.
+ */
+
+/**
+ * @fn openvrml::event_emitter::field_value_listener_table::~field_value_listener_table()
+ *
+ * @brief Destroy.
+ */
+
+/**
+ * @internal
+ *
+ * @class openvrml::event_emitter::dispatch_guard
+ *
+ * @brief Count an @c emit_event call in progress for the lifetime of the
+ *        guard.
+ */
+
+/**
+ * @var boost::atomic<size_t> & openvrml::event_emitter::dispatch_guard::dispatching_
+ *
+ * @brief The counter.
+ */
+
+/**
+ * @fn openvrml::event_emitter::dispatch_guard::dispatch_guard(boost::atomic<size_t> & dispatching)
+ *
+ * @brief Construct; increment @p dispatching.
+ *
+ * @param[in,out] dispatching   the counter.
+ */
+
+/**
+ * @fn openvrml::event_emitter::dispatch_guard::~dispatch_guard()
+ *
+ * @brief Destroy; decrement the counter.
+ */
+
+/**
+ * @internal
+ *
+ * @var boost::atomic<const openvrml::event_emitter::listener_table *> openvrml::event_emitter::listener_table_
+ *
+ * @brief The dispatch table for @c #listeners_.
+ *
+ * @c #add and @c #remove build a new table, with the listeners already cast
+ * to the concrete @c field_value_listener type, and publish it here; so
+ * @c emit_event neither locks nor uses RTTI.  A table is never modified once
+ * it has been published.
+ */
+
+/**
+ * @internal
+ *
+ * @var boost::atomic<size_t> openvrml::event_emitter::dispatching_
+ *
+ * @brief The number of @c emit_event calls in progress.
+ *
+ * A table replaced while this is nonzero may still be in use; it is kept in
+ * @c #retired_listener_tables_.
+ */
+
+/**
+ * @internal
+ *
+ * @var std::vector<const openvrml::event_emitter::listener_table *> openvrml::event_emitter::retired_listener_tables_
+ *
+ * @brief Replaced dispatch tables that may still be in use by
+ *        @c emit_event.
+ *
+ * The tables are deleted by the first @c #replace_listener_table call that
+ * finds no @c emit_event in progress, or by the destructor.  Access is
+ * guarded by @c #listeners_mutex_.
+ */
+
+/**
+ * @internal
+ *
+ * @var boost::atomic<double> openvrml::event_emitter::last_time_
  *
  * @brief The timestamp of the last event emitted.
  */
@@ -453,9 +570,13 @@ const std::string openvrml::node_event_listener::eventin_id() const
 /**
  * @internal
  *
- * @var boost::shared_mutex openvrml::event_emitter::last_time_mutex_
+ * @var boost::atomic<double> openvrml::event_emitter::cascade_time_
+ *
+ * @brief The timestamp of the last event from this emitter accepted by
+ *        @c browser::queue_event.
  *
- * @brief Mutex guarding @c #last_time_.
+ * An @c eventOut emits at most one event per timestamp; the @c browser drops
+ * any further events with the same timestamp.
  */
 
 /**
@@ -466,14 +587,25 @@ const std::string openvrml::node_event_listener::eventin_id() const
 openvrml::event_emitter::event_emitter(const field_value & value)
     OPENVRML_NOTHROW:
     value_(value),
-    last_time_(0.0)
+    listener_table_(0),
+    dispatching_(0),
+    last_time_(0.0),
+    cascade_time_(std::numeric_limits<double>::quiet_NaN())
 {}
 
 /**
  * @brief Destroy.
  */
 openvrml::event_emitter::~event_emitter() OPENVRML_NOTHROW
-{}
+{
+    delete this->listener_table_.load();
+    for (std::vector<const listener_table *>::const_iterator table =
+             this->retired_listener_tables_.begin();
+         table != this->retired_listener_tables_.end();
+         ++table) {
+        delete *table;
+    }
+}
 
 /**
  * @brief A reference to the @c field_value for the @c event_emitter.
@@ -509,6 +641,21 @@ const std::string openvrml::event_emitter::eventout_id() const
  * @return the associated eventOut identifier.
  */
 
+/**
+ * @brief The @c node that emits events through this emitter.
+ *
+ * @c node::emit_event uses the @c node to find the @c browser whose event
+ * queue should receive the event.  The default implementation returns 0,
+ * in which case events are delivered to listeners immediately.
+ *
+ * @return the @c node that emits events through this emitter, or 0 if it is
+ *         not known.
+ */
+openvrml::node * openvrml::event_emitter::do_node() const OPENVRML_NOTHROW
+{
+    return 0;
+}
+
 /**
  * @brief The timestamp of the last event emitted.
  *
@@ -516,9 +663,6 @@ const std::string openvrml::event_emitter::eventout_id() const
  */
 double openvrml::event_emitter::last_time() const OPENVRML_NOTHROW
 {
-    using boost::shared_lock;
-    using boost::shared_mutex;
-    shared_lock<shared_mutex> lock(this->last_time_mutex_);
     return this->last_time_;
 }
 
@@ -542,6 +686,8 @@ double openvrml::event_emitter::last_time() const OPENVRML_NOTHROW
  * @tparam FieldValue   a @link FieldValueConcept Field Value@endlink.
  *
  * @param[in] listener  an event listener.
+ *
+ * @exception std::bad_alloc    if memory allocation fails.
  */
 
 /**
@@ -554,11 +700,55 @@ double openvrml::event_emitter::last_time() const OPENVRML_NOTHROW
  * @return the event listeners currently listening to the emitter.
  */
 
+/**
+ * @brief Publish a new dispatch table.
+ *
+ * The caller must hold a unique lock on @c #listeners_mutex_.  The table
+ * being replaced is deleted as soon as no @c emit_event call can be using
+ * it.
+ *
+ * @param[in] table the new table, or 0 if there are no listeners.  The
+ *                  @c event_emitter takes ownership of it, even if this
+ *                  function throws.
+ *
+ * @exception std::bad_alloc    if memory allocation fails.
+ */
+void
+openvrml::event_emitter::replace_listener_table(const listener_table * table)
+    OPENVRML_THROW1(std::bad_alloc)
+{
+    try {
+        this->retired_listener_tables_.reserve(
+            this->retired_listener_tables_.size() + 1);
+    } catch (std::bad_alloc &) {
+        delete table;
+        throw;
+    }
+    const listener_table * const old = this->listener_table_.exchange(table);
+    if (old) { this->retired_listener_tables_.push_back(old); }
+
+    //
+    // An emit_event that starts after the exchange above sees the new table;
+    // so if none is in progress now, none can be using a retired one.
+    //
+    if (this->dispatching_ == 0) {
+        for (std::vector<const listener_table *>::const_iterator retired =
+                 this->retired_listener_tables_.begin();
+             retired != this->retired_listener_tables_.end();
+             ++retired) {
+            delete *retired;
+        }
+        this->retired_listener_tables_.clear();
+    }
+}
+
 /**
  * @fn void openvrml::event_emitter::emit_event<FieldValue>(double timestamp)
  *
  * @brief Emit an event.
  *
+ * Listeners are called through @c #listener_table_.
+ *
  * @tparam FieldValue   a @link FieldValueConcept Field Value@endlink.
  *
  * @param[in] timestamp the current time.
@@ -21,12 +21,17 @@
 # ifndef OPENVRML_EVENT_H
 #   define OPENVRML_EVENT_H
 
+#   include <algorithm>
+#   include <iterator>
 #   include <set>
+#   include <vector>
+#   include <boost/atomic.hpp>
 #   include <openvrml/field_value.h>
 
 namespace openvrml {
 
     class node;
+    class browser;
 
     class OPENVRML_API event_listener : boost::noncopyable {
     public:
@@ -159,14 +164,53 @@ namespace openvrml {
 
     class OPENVRML_API event_emitter : boost::noncopyable {
         friend class node;
+        friend class browser;
+
+        class OPENVRML_API listener_table : boost::noncopyable {
+        public:
+            virtual ~listener_table() OPENVRML_NOTHROW = 0;
+        };
+
+        template <typename FieldValue>
+        class field_value_listener_table : public listener_table {
+        public:
+            typedef std::vector<field_value_listener<FieldValue> *>
+                listener_vector;
+
+            listener_vector listeners;
+
+            virtual ~field_value_listener_table() OPENVRML_NOTHROW
+            {}
+        };
+
+        class dispatch_guard : boost::noncopyable {
+            boost::atomic<size_t> & dispatching_;
+
+        public:
+            explicit dispatch_guard(boost::atomic<size_t> & dispatching)
+                OPENVRML_NOTHROW:
+                dispatching_(dispatching)
+            {
+                ++this->dispatching_;
+            }
+
+            ~dispatch_guard() OPENVRML_NOTHROW
+            {
+                --this->dispatching_;
+            }
+        };
 
         const field_value & value_;
 
         std::set<event_listener *> listeners_;
         mutable boost::shared_mutex listeners_mutex_;
 
-        double last_time_;
-        mutable boost::shared_mutex last_time_mutex_;
+        boost::atomic<const listener_table *> listener_table_;
+        boost::atomic<size_t> dispatching_;
+        std::vector<const listener_table *> retired_listener_tables_;
+
+        boost::atomic<double> last_time_;
+        boost::atomic<double> cascade_time_;
 
     public:
         typedef std::set<event_listener *> listener_set;
@@ -185,7 +229,7 @@ namespace openvrml {
             OPENVRML_THROW1(std::bad_alloc);
         template <typename FieldValue>
         bool remove(field_value_listener<FieldValue> & listener)
-            OPENVRML_NOTHROW;
+            OPENVRML_THROW1(std::bad_alloc);
 
         template <typename FieldValue>
         const std::set<field_value_listener<FieldValue> *> listeners() const
@@ -195,7 +239,11 @@ namespace openvrml {
         void emit_event(double timestamp) OPENVRML_THROW1(std::bad_alloc);
 
     private:
+        void replace_listener_table(const listener_table * table)
+            OPENVRML_THROW1(std::bad_alloc);
+
         virtual const std::string do_eventout_id() const OPENVRML_NOTHROW = 0;
+        virtual openvrml::node * do_node() const OPENVRML_NOTHROW;
         virtual void emit_event(double timestamp)
             OPENVRML_THROW1(std::bad_alloc) = 0;
     };
@@ -204,20 +252,56 @@ namespace openvrml {
     bool event_emitter::add(field_value_listener<FieldValue> & listener)
         OPENVRML_THROW1(std::bad_alloc)
     {
+        typedef field_value_listener_table<FieldValue> table_t;
+
         using boost::unique_lock;
         using boost::shared_mutex;
         unique_lock<shared_mutex> lock(this->listeners_mutex_);
-        return this->listeners_.insert(&listener).second;
+        if (!this->listeners_.insert(&listener).second) { return false; }
+        try {
+            std::auto_ptr<table_t> table(new table_t);
+            const table_t * const current =
+                static_cast<const table_t *>(this->listener_table_.load());
+            if (current) {
+                table->listeners.reserve(current->listeners.size() + 1);
+                table->listeners = current->listeners;
+            }
+            table->listeners.push_back(&listener);
+            this->replace_listener_table(table.release());
+        } catch (std::bad_alloc &) {
+            this->listeners_.erase(&listener);
+            throw;
+        }
+        return true;
     }
 
     template <typename FieldValue>
     bool event_emitter::remove(field_value_listener<FieldValue> & listener)
-        OPENVRML_NOTHROW
+        OPENVRML_THROW1(std::bad_alloc)
     {
+        typedef field_value_listener_table<FieldValue> table_t;
+
         using boost::unique_lock;
         using boost::shared_mutex;
         unique_lock<shared_mutex> lock(this->listeners_mutex_);
-        return (this->listeners_.erase(&listener) > 0);
+        if (this->listeners_.find(&listener) == this->listeners_.end()) {
+            return false;
+        }
+        const table_t * const current =
+            static_cast<const table_t *>(this->listener_table_.load());
+        assert(current);
+        std::auto_ptr<table_t> table;
+        if (current->listeners.size() > 1) {
+            table.reset(new table_t);
+            table->listeners.reserve(current->listeners.size() - 1);
+            std::remove_copy(current->listeners.begin(),
+                             current->listeners.end(),
+                             std::back_inserter(table->listeners),
+                             &listener);
+        }
+        this->replace_listener_table(table.release());
+        this->listeners_.erase(&listener);
+        return true;
     }
 
     template <typename FieldValue>
@@ -225,42 +309,43 @@ namespace openvrml {
     event_emitter::listeners() const
         OPENVRML_THROW1(std::bad_alloc)
     {
-        struct cast {
-            field_value_listener<FieldValue> *
-            operator()(event_listener * listener) const OPENVRML_NOTHROW
-            {
-                field_value_listener<FieldValue> * const result =
-                    dynamic_cast<field_value_listener<FieldValue> *>(listener);
-                assert(result);
-                return result;
-            }
-        };
+        typedef field_value_listener_table<FieldValue> table_t;
+
         boost::shared_lock<boost::shared_mutex> lock(this->listeners_mutex_);
-        std::set<field_value_listener<FieldValue> *> result;
-        std::transform(this->listeners_.begin(), this->listeners_.end(),
-                       inserter(result, result.begin()),
-                       cast());
-        return result;
+        const table_t * const table =
+            static_cast<const table_t *>(this->listener_table_.load());
+        return table
+            ? std::set<field_value_listener<FieldValue> *>(
+                table->listeners.begin(), table->listeners.end())
+            : std::set<field_value_listener<FieldValue> *>();
     }
 
     template <typename FieldValue>
     void event_emitter::emit_event(const double timestamp)
         OPENVRML_THROW1(std::bad_alloc)
     {
-        using boost::shared_lock;
-        using boost::shared_mutex;
-        shared_lock<shared_mutex> listeners_lock(this->listeners_mutex_);
-        shared_lock<shared_mutex> last_time_lock(this->last_time_mutex_);
-        for (typename listener_set::iterator listener =
-                 this->listeners_.begin();
-             listener != this->listeners_.end();
-             ++listener) {
-            using boost::polymorphic_downcast;
-            assert(*listener);
-            dynamic_cast<field_value_listener<FieldValue> &>(**listener)
-                .process_event(
-                    *polymorphic_downcast<const FieldValue *>(&this->value()),
-                    timestamp);
+        typedef field_value_listener_table<FieldValue> table_t;
+
+        {
+            //
+            // While dispatching_ is nonzero, a table replaced by add or
+            // remove is not deleted; so a listener may add or remove routes
+            // on this emitter without invalidating the iteration.
+            //
+            dispatch_guard guard(this->dispatching_);
+            const table_t * const table =
+                static_cast<const table_t *>(this->listener_table_.load());
+            if (table) {
+                using boost::polymorphic_downcast;
+                const FieldValue & value =
+                    *polymorphic_downcast<const FieldValue *>(&this->value());
+                for (typename table_t::listener_vector::const_iterator
+                         listener = table->listeners.begin();
+                     listener != table->listeners.end();
+                     ++listener) {
+                    (*listener)->process_event(value, timestamp);
+                }
+            }
         }
         this->last_time_ = timestamp;
     }
@@ -278,7 +363,7 @@ namespace openvrml {
         bool add(field_value_listener<FieldValue> & listener)
             OPENVRML_THROW1(std::bad_alloc);
         bool remove(field_value_listener<FieldValue> & listener)
-            OPENVRML_NOTHROW;
+            OPENVRML_THROW1(std::bad_alloc);
 
         const std::set<field_value_listener<FieldValue> *> listeners() const
             OPENVRML_THROW1(std::bad_alloc);
@@ -320,7 +405,8 @@ namespace openvrml {
     template <typename FieldValue>
     inline bool
     field_value_emitter<FieldValue>::
-    remove(field_value_listener<FieldValue> & listener) OPENVRML_NOTHROW
+    remove(field_value_listener<FieldValue> & listener)
+        OPENVRML_THROW1(std::bad_alloc)
     {
         return this->event_emitter::template remove<FieldValue>(listener);
     }
@@ -85,6 +85,8 @@
  *
  * This function performs the following steps:
  *
+ * -# if @p FieldValue is @c sfnode or @c mfnode, update the
+ *    <code>node</code>'s parent links (see @c node::relink_children).
  * -# set the @c exposedField value.
  * -# call @c exposedfield<FieldValue>::event_side_effect.
  * -# set the modified flag.
@@ -118,3 +120,13 @@
  *
  * @exception std::bad_alloc    if memory allocation fails.
  */
+
+/**
+ * @fn openvrml::node * openvrml::exposedfield::do_node() const
+ *
+ * @brief The @c node to which the @c exposedField belongs.
+ *
+ * @tparam FieldValue   a @link FieldValueConcept Field Value@endlink.
+ *
+ * @return the @c node to which the @c exposedField belongs.
+ */
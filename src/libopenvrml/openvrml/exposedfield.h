@@ -49,6 +49,7 @@ namespace openvrml {
         virtual void event_side_effect(const FieldValue & value,
                                        double timestamp)
             OPENVRML_THROW1(std::bad_alloc);
+        virtual openvrml::node * do_node() const OPENVRML_NOTHROW;
     };
 
     template <typename FieldValue>
@@ -83,6 +84,8 @@ namespace openvrml {
                                                const double timestamp)
         OPENVRML_THROW1(std::bad_alloc)
     {
+        this->node().relink_children(static_cast<const FieldValue &>(*this),
+                                     value);
         static_cast<FieldValue &>(*this) = value;
         this->event_side_effect(value, timestamp);
         this->node().modified(true);
@@ -94,6 +97,13 @@ namespace openvrml {
     exposedfield<FieldValue>::event_side_effect(const FieldValue &, double)
         OPENVRML_THROW1(std::bad_alloc)
     {}
+
+    template <typename FieldValue>
+    inline openvrml::node *
+    exposedfield<FieldValue>::do_node() const OPENVRML_NOTHROW
+    {
+        return &this->node();
+    }
 }
 
 # endif
@@ -92,6 +92,28 @@ openvrml::field_value::counted_impl_base::clone() const OPENVRML_THROW1(std::bad
     return this->do_clone();
 }
 
+/**
+ * @brief The mutex serializing writes to @p impl.
+ *
+ * Writers are rare compared to readers, so rather than give every field
+ * value its own mutex, writers share a small, fixed pool of mutexes
+ * selected by address.
+ *
+ * @param[in] impl  a @c counted_impl_base.
+ *
+ * @return the mutex that serializes writes to @p impl.
+ */
+boost::mutex &
+openvrml::field_value::counted_impl_base::
+write_mutex(const counted_impl_base & impl) OPENVRML_NOTHROW
+{
+    static boost::mutex pool[41];
+    const std::size_t index =
+        (reinterpret_cast<std::size_t>(&impl) / sizeof(void *))
+        % (sizeof pool / sizeof pool[0]);
+    return pool[index];
+}
+
 /**
  * @fn std::auto_ptr<openvrml::field_value::counted_impl_base> openvrml::field_value::counted_impl_base::do_clone() const
  *
@@ -111,23 +133,85 @@ openvrml::field_value::counted_impl_base::clone() const OPENVRML_THROW1(std::bad
  *
  * @brief Concrete reference-counted implementation.
  *
+ * The value is held in an immutable, reference-counted @c version.  Copies
+ * share the @c version; a write publishes a new one.  Reading the value
+ * does not lock or modify any shared state: it is a single atomic load of
+ * @c #current_.
+ *
+ * A reference returned by @c #value() remains valid until the value has
+ * been written twice more: each write keeps the @c version it replaces
+ * until the next write.  (The same @c version is also kept alive by any
+ * copy that shares it.)  Code that needs a value across writes should copy
+ * the field value; copying is cheap since it only takes a reference to
+ * the current @c version.
+ *
  * @tparam ValueType    a @link FieldValueConcept Field Value@endlink
  *                      @c value_type.
  */
 
 /**
- * @var boost::shared_mutex openvrml::field_value::counted_impl::mutex_
+ * @internal
+ *
+ * @class openvrml::field_value::counted_impl::version openvrml/field_value.h
+ *
+ * @brief An immutable, reference-counted value.
+ */
+
+/**
+ * @var boost::atomic<std::size_t> openvrml::field_value::counted_impl::version::refs
+ *
+ * @brief The number of @c counted_impl instances referring to this
+ *        @c version.
+ */
+
+/**
+ * @var ValueType openvrml::field_value::counted_impl::version::value
+ *
+ * @brief The value.
+ *
+ * Not modified once the @c version has been published.
+ */
+
+/**
+ * @fn openvrml::field_value::counted_impl::version::version()
+ *
+ * @brief Construct with a reference count of one and a default value.
+ *
+ * @exception std::bad_alloc    if memory allocation fails.
+ */
+
+/**
+ * @fn openvrml::field_value::counted_impl::version::version(const ValueType & value)
  *
- * @brief Mutex protecting @c #value_.
+ * @brief Construct with a reference count of one.
+ *
+ * @param[in] value the value.
+ *
+ * @exception std::bad_alloc    if memory allocation fails.
+ */
+
+/**
+ * @var boost::atomic<const openvrml::field_value::counted_impl::version *> openvrml::field_value::counted_impl::current_
+ *
+ * @brief The current @c version.
+ */
+
+/**
+ * @var boost::atomic<std::size_t> openvrml::field_value::counted_impl::copying_
+ *
+ * @brief The number of copies of this @c counted_impl in progress.
+ *
+ * A copy must load @c #current_ and then increment the @c version's
+ * reference count.  While @c #copying_ is nonzero, writers do not release
+ * retired versions, so the @c version cannot be freed in between.
  */
 
 /**
- * @var boost::shared_ptr<ValueType> openvrml::field_value::counted_impl::value_
+ * @var std::vector<const openvrml::field_value::counted_impl::version *> openvrml::field_value::counted_impl::retired_
  *
- * @brief A @c shared_ptr to an instance of the @c value_type of a
- *        @link openvrml::FieldValueConcept Field Value@endlink.
+ * @brief Versions replaced by writes that have not yet been released.
  *
- * @sa http://boost.org/libs/smart_ptr/shared_ptr.htm
+ * Guarded by @c counted_impl_base::write_mutex.
  */
 
 /**
@@ -169,11 +253,22 @@ openvrml::field_value::counted_impl_base::clone() const OPENVRML_THROW1(std::bad
  * @brief Not implemented.
  */
 
+/**
+ * @fn void openvrml::field_value::counted_impl::release(const version * v)
+ *
+ * @brief Decrement the reference count of @p v, deleting it if the count
+ *        reaches zero.
+ *
+ * @param[in] v a @c version.
+ */
+
 /**
  * @fn const ValueType & openvrml::field_value::counted_impl::value() const
  *
  * @brief Access.
  *
+ * This function does not lock.
+ *
  * @tparam ValueType    a @link FieldValueConcept Field Value@endlink
  *                      @c value_type.
  *
@@ -185,6 +280,8 @@ openvrml::field_value::counted_impl_base::clone() const OPENVRML_THROW1(std::bad
  *
  * @brief Mutate.
  *
+ * Publishes a new @c version containing @p val.
+ *
  * @tparam ValueType    a @link FieldValueConcept Field Value@endlink
  *                      @c value_type.
  *
@@ -193,6 +290,37 @@ openvrml::field_value::counted_impl_base::clone() const OPENVRML_THROW1(std::bad
  * @exception std::bad_alloc    if memory allocation fails.
  */
 
+/**
+ * @fn void openvrml::field_value::counted_impl::take_value(ValueType & val)
+ *
+ * @brief Mutate, taking the contents of @p val.
+ *
+ * Publishes a new @c version whose value has been swapped with @p val.
+ *
+ * @tparam ValueType    a @link FieldValueConcept Field Value@endlink
+ *                      @c value_type.
+ *
+ * @param[in,out] val   the new value.
+ *
+ * @exception std::bad_alloc    if memory allocation fails.
+ *
+ * @post @p val has the default value of @p ValueType.  If an exception is
+ *       thrown, @p val is unchanged.
+ */
+
+/**
+ * @fn void openvrml::field_value::counted_impl::publish(std::auto_ptr<version> & v)
+ *
+ * @brief Make @p v the current @c version.
+ *
+ * @param[in,out] v a new @c version.
+ *
+ * @exception std::bad_alloc    if memory allocation fails.
+ *
+ * @post If no exception is thrown, @p v is null.  Otherwise, it is
+ *       unchanged.
+ */
+
 /**
  * @fn std::auto_ptr<openvrml::field_value::counted_impl_base> openvrml::field_value::counted_impl::do_clone() const
  *
@@ -627,6 +755,21 @@ openvrml::field_value::type_id openvrml::field_value::type() const
  * @exception std::bad_alloc    if memory allocation fails.
  */
 
+/**
+ * @fn void openvrml::field_value::take_value(typename FieldValue::value_type & val)
+ *
+ * @brief Mutate, taking the contents of @p val.
+ *
+ * @tparam FieldValue a @link FieldValueConcept Field Value@endlink.
+ *
+ * @param[in,out] val   new value.
+ *
+ * @exception std::bad_alloc    if memory allocation fails.
+ *
+ * @post @p val has the default value of its type.  If an exception is
+ *       thrown, @p val is unchanged.
+ */
+
 namespace {
     typedef boost::array<const char *, 31> field_value_type_id;
     const field_value_type_id field_value_type_id_ = {
@@ -3628,6 +3771,24 @@ void openvrml::mfbool::value(const value_type & val)
     this->field_value::value<mfbool>(val);
 }
 
+/**
+ * @brief Mutate, taking the contents of @p val.
+ *
+ * Unlike @c #value(const value_type &), this function does not copy the
+ * elements of @p val.
+ *
+ * @param[in,out] val   the new value.
+ *
+ * @exception std::bad_alloc    if memory allocation fails.
+ *
+ * @post @p val is empty.  If an exception is thrown, @p val is unchanged.
+ */
+void openvrml::mfbool::take_value(value_type & val)
+    OPENVRML_THROW1(std::bad_alloc)
+{
+    this->field_value::take_value<mfbool>(val);
+}
+
 /**
  * @brief Swap.
  *
@@ -3838,6 +3999,24 @@ void openvrml::mfcolor::value(const value_type & val)
     this->field_value::value<mfcolor>(val);
 }
 
+/**
+ * @brief Mutate, taking the contents of @p val.
+ *
+ * Unlike @c #value(const value_type &), this function does not copy the
+ * elements of @p val.
+ *
+ * @param[in,out] val   the new value.
+ *
+ * @exception std::bad_alloc    if memory allocation fails.
+ *
+ * @post @p val is empty.  If an exception is thrown, @p val is unchanged.
+ */
+void openvrml::mfcolor::take_value(value_type & val)
+    OPENVRML_THROW1(std::bad_alloc)
+{
+    this->field_value::take_value<mfcolor>(val);
+}
+
 /**
  * @brief Swap.
  *
@@ -4048,6 +4227,24 @@ void openvrml::mfcolorrgba::value(const value_type & val)
     this->field_value::value<mfcolorrgba>(val);
 }
 
+/**
+ * @brief Mutate, taking the contents of @p val.
+ *
+ * Unlike @c #value(const value_type &), this function does not copy the
+ * elements of @p val.
+ *
+ * @param[in,out] val   the new value.
+ *
+ * @exception std::bad_alloc    if memory allocation fails.
+ *
+ * @post @p val is empty.  If an exception is thrown, @p val is unchanged.
+ */
+void openvrml::mfcolorrgba::take_value(value_type & val)
+    OPENVRML_THROW1(std::bad_alloc)
+{
+    this->field_value::take_value<mfcolorrgba>(val);
+}
+
 /**
  * @brief Swap.
  *
@@ -4258,6 +4455,24 @@ void openvrml::mffloat::value(const value_type & val)
     this->field_value::value<mffloat>(val);
 }
 
+/**
+ * @brief Mutate, taking the contents of @p val.
+ *
+ * Unlike @c #value(const value_type &), this function does not copy the
+ * elements of @p val.
+ *
+ * @param[in,out] val   the new value.
+ *
+ * @exception std::bad_alloc    if memory allocation fails.
+ *
+ * @post @p val is empty.  If an exception is thrown, @p val is unchanged.
+ */
+void openvrml::mffloat::take_value(value_type & val)
+    OPENVRML_THROW1(std::bad_alloc)
+{
+    this->field_value::take_value<mffloat>(val);
+}
+
 /**
  * @brief Swap.
  *
@@ -4466,6 +4681,24 @@ void openvrml::mfdouble::value(const value_type & val)
     this->field_value::value<mfdouble>(val);
 }
 
+/**
+ * @brief Mutate, taking the contents of @p val.
+ *
+ * Unlike @c #value(const value_type &), this function does not copy the
+ * elements of @p val.
+ *
+ * @param[in,out] val   the new value.
+ *
+ * @exception std::bad_alloc    if memory allocation fails.
+ *
+ * @post @p val is empty.  If an exception is thrown, @p val is unchanged.
+ */
+void openvrml::mfdouble::take_value(value_type & val)
+    OPENVRML_THROW1(std::bad_alloc)
+{
+    this->field_value::take_value<mfdouble>(val);
+}
+
 /**
  * @brief Swap.
  *
@@ -4674,6 +4907,24 @@ void openvrml::mfimage::value(const value_type & val)
     this->field_value::value<mfimage>(val);
 }
 
+/**
+ * @brief Mutate, taking the contents of @p val.
+ *
+ * Unlike @c #value(const value_type &), this function does not copy the
+ * elements of @p val.
+ *
+ * @param[in,out] val   the new value.
+ *
+ * @exception std::bad_alloc    if memory allocation fails.
+ *
+ * @post @p val is empty.  If an exception is thrown, @p val is unchanged.
+ */
+void openvrml::mfimage::take_value(value_type & val)
+    OPENVRML_THROW1(std::bad_alloc)
+{
+    this->field_value::take_value<mfimage>(val);
+}
+
 /**
  * @brief Swap.
  *
@@ -4882,6 +5133,24 @@ void openvrml::mfint32::value(const value_type & val)
     this->field_value::value<mfint32>(val);
 }
 
+/**
+ * @brief Mutate, taking the contents of @p val.
+ *
+ * Unlike @c #value(const value_type &), this function does not copy the
+ * elements of @p val.
+ *
+ * @param[in,out] val   the new value.
+ *
+ * @exception std::bad_alloc    if memory allocation fails.
+ *
+ * @post @p val is empty.  If an exception is thrown, @p val is unchanged.
+ */
+void openvrml::mfint32::take_value(value_type & val)
+    OPENVRML_THROW1(std::bad_alloc)
+{
+    this->field_value::take_value<mfint32>(val);
+}
+
 /**
  * @brief Swap.
  *
@@ -5091,6 +5360,24 @@ void openvrml::mfnode::value(const value_type & val)
     this->field_value::value<mfnode>(val);
 }
 
+/**
+ * @brief Mutate, taking the contents of @p val.
+ *
+ * Unlike @c #value(const value_type &), this function does not copy the
+ * elements of @p val.
+ *
+ * @param[in,out] val   the new value.
+ *
+ * @exception std::bad_alloc    if memory allocation fails.
+ *
+ * @post @p val is empty.  If an exception is thrown, @p val is unchanged.
+ */
+void openvrml::mfnode::take_value(value_type & val)
+    OPENVRML_THROW1(std::bad_alloc)
+{
+    this->field_value::take_value<mfnode>(val);
+}
+
 /**
  * @brief Swap.
  *
@@ -5303,6 +5590,24 @@ void openvrml::mfrotation::value(const value_type & val)
     this->field_value::value<mfrotation>(val);
 }
 
+/**
+ * @brief Mutate, taking the contents of @p val.
+ *
+ * Unlike @c #value(const value_type &), this function does not copy the
+ * elements of @p val.
+ *
+ * @param[in,out] val   the new value.
+ *
+ * @exception std::bad_alloc    if memory allocation fails.
+ *
+ * @post @p val is empty.  If an exception is thrown, @p val is unchanged.
+ */
+void openvrml::mfrotation::take_value(value_type & val)
+    OPENVRML_THROW1(std::bad_alloc)
+{
+    this->field_value::take_value<mfrotation>(val);
+}
+
 /**
  * @brief Swap.
  *
@@ -5515,6 +5820,24 @@ void openvrml::mfstring::value(const value_type & val)
     this->field_value::value<mfstring>(val);
 }
 
+/**
+ * @brief Mutate, taking the contents of @p val.
+ *
+ * Unlike @c #value(const value_type &), this function does not copy the
+ * elements of @p val.
+ *
+ * @param[in,out] val   the new value.
+ *
+ * @exception std::bad_alloc    if memory allocation fails.
+ *
+ * @post @p val is empty.  If an exception is thrown, @p val is unchanged.
+ */
+void openvrml::mfstring::take_value(value_type & val)
+    OPENVRML_THROW1(std::bad_alloc)
+{
+    this->field_value::take_value<mfstring>(val);
+}
+
 /**
  * @brief Swap.
  *
@@ -5725,6 +6048,24 @@ void openvrml::mftime::value(const value_type & val)
     this->field_value::value<mftime>(val);
 }
 
+/**
+ * @brief Mutate, taking the contents of @p val.
+ *
+ * Unlike @c #value(const value_type &), this function does not copy the
+ * elements of @p val.
+ *
+ * @param[in,out] val   the new value.
+ *
+ * @exception std::bad_alloc    if memory allocation fails.
+ *
+ * @post @p val is empty.  If an exception is thrown, @p val is unchanged.
+ */
+void openvrml::mftime::take_value(value_type & val)
+    OPENVRML_THROW1(std::bad_alloc)
+{
+    this->field_value::take_value<mftime>(val);
+}
+
 /**
  * @brief Swap.
  *
@@ -5936,6 +6277,24 @@ void openvrml::mfvec2f::value(const value_type & val)
     this->field_value::value<mfvec2f>(val);
 }
 
+/**
+ * @brief Mutate, taking the contents of @p val.
+ *
+ * Unlike @c #value(const value_type &), this function does not copy the
+ * elements of @p val.
+ *
+ * @param[in,out] val   the new value.
+ *
+ * @exception std::bad_alloc    if memory allocation fails.
+ *
+ * @post @p val is empty.  If an exception is thrown, @p val is unchanged.
+ */
+void openvrml::mfvec2f::take_value(value_type & val)
+    OPENVRML_THROW1(std::bad_alloc)
+{
+    this->field_value::take_value<mfvec2f>(val);
+}
+
 /**
  * @brief Swap.
  *
@@ -6145,6 +6504,24 @@ void openvrml::mfvec2d::value(const value_type & val)
     this->field_value::value<mfvec2d>(val);
 }
 
+/**
+ * @brief Mutate, taking the contents of @p val.
+ *
+ * Unlike @c #value(const value_type &), this function does not copy the
+ * elements of @p val.
+ *
+ * @param[in,out] val   the new value.
+ *
+ * @exception std::bad_alloc    if memory allocation fails.
+ *
+ * @post @p val is empty.  If an exception is thrown, @p val is unchanged.
+ */
+void openvrml::mfvec2d::take_value(value_type & val)
+    OPENVRML_THROW1(std::bad_alloc)
+{
+    this->field_value::take_value<mfvec2d>(val);
+}
+
 /**
  * @brief Swap.
  *
@@ -6355,6 +6732,24 @@ void openvrml::mfvec3f::value(const value_type & val)
     this->field_value::value<mfvec3f>(val);
 }
 
+/**
+ * @brief Mutate, taking the contents of @p val.
+ *
+ * Unlike @c #value(const value_type &), this function does not copy the
+ * elements of @p val.
+ *
+ * @param[in,out] val   the new value.
+ *
+ * @exception std::bad_alloc    if memory allocation fails.
+ *
+ * @post @p val is empty.  If an exception is thrown, @p val is unchanged.
+ */
+void openvrml::mfvec3f::take_value(value_type & val)
+    OPENVRML_THROW1(std::bad_alloc)
+{
+    this->field_value::take_value<mfvec3f>(val);
+}
+
 /**
  * @brief Swap.
  *
@@ -6565,6 +6960,24 @@ void openvrml::mfvec3d::value(const value_type & val)
     this->field_value::value<mfvec3d>(val);
 }
 
+/**
+ * @brief Mutate, taking the contents of @p val.
+ *
+ * Unlike @c #value(const value_type &), this function does not copy the
+ * elements of @p val.
+ *
+ * @param[in,out] val   the new value.
+ *
+ * @exception std::bad_alloc    if memory allocation fails.
+ *
+ * @post @p val is empty.  If an exception is thrown, @p val is unchanged.
+ */
+void openvrml::mfvec3d::take_value(value_type & val)
+    OPENVRML_THROW1(std::bad_alloc)
+{
+    this->field_value::take_value<mfvec3d>(val);
+}
+
 /**
  * @brief Swap.
  *
@@ -25,6 +25,8 @@
 #   include <memory>
 #   include <string>
 #   include <typeinfo>
+#   include <vector>
+#   include <boost/atomic.hpp>
 #   include <boost/cast.hpp>
 #   include <boost/concept_check.hpp>
 #   include <boost/intrusive_ptr.hpp>
@@ -52,6 +54,10 @@ namespace openvrml {
             std::auto_ptr<counted_impl_base> clone() const
                 OPENVRML_THROW1(std::bad_alloc);
 
+        protected:
+            static boost::mutex & write_mutex(const counted_impl_base & impl)
+                OPENVRML_NOTHROW;
+
         private:
             virtual std::auto_ptr<counted_impl_base> do_clone() const
                 OPENVRML_THROW1(std::bad_alloc) = 0;
@@ -59,8 +65,18 @@ namespace openvrml {
 
         template <typename ValueType>
         class counted_impl : public counted_impl_base {
-            mutable boost::shared_mutex mutex_;
-            boost::shared_ptr<ValueType> value_;
+            struct version : boost::noncopyable {
+                mutable boost::atomic<std::size_t> refs;
+                ValueType value;
+
+                version() OPENVRML_THROW1(std::bad_alloc);
+                explicit version(const ValueType & value)
+                    OPENVRML_THROW1(std::bad_alloc);
+            };
+
+            boost::atomic<const version *> current_;
+            mutable boost::atomic<std::size_t> copying_;
+            std::vector<const version *> retired_;
 
         public:
             explicit counted_impl(const ValueType & value)
@@ -70,11 +86,17 @@ namespace openvrml {
 
             const ValueType & value() const OPENVRML_NOTHROW;
             void value(const ValueType & val) OPENVRML_THROW1(std::bad_alloc);
+            void take_value(ValueType & val) OPENVRML_THROW1(std::bad_alloc);
 
         private:
             counted_impl<ValueType> &
             operator=(const counted_impl<ValueType> &);
 
+            static void release(const version * v) OPENVRML_NOTHROW;
+
+            void publish(std::auto_ptr<version> & v)
+                OPENVRML_THROW1(std::bad_alloc);
+
             virtual std::auto_ptr<counted_impl_base> do_clone() const
                 OPENVRML_THROW1(std::bad_alloc);
         };
@@ -135,6 +157,10 @@ namespace openvrml {
         void value(const typename FieldValue::value_type & val)
             OPENVRML_THROW1(std::bad_alloc);
 
+        template <typename FieldValue>
+        void take_value(typename FieldValue::value_type & val)
+            OPENVRML_THROW1(std::bad_alloc);
+
         template <typename FieldValue>
         void swap(FieldValue & val) OPENVRML_NOTHROW;
 
@@ -164,50 +190,121 @@ namespace openvrml {
         virtual void print(std::ostream & out) const = 0;
     };
 
+    template <typename ValueType>
+    field_value::counted_impl<ValueType>::version::version()
+        OPENVRML_THROW1(std::bad_alloc):
+        refs(1),
+        value()
+    {}
+
+    template <typename ValueType>
+    field_value::counted_impl<ValueType>::version::
+    version(const ValueType & value) OPENVRML_THROW1(std::bad_alloc):
+        refs(1),
+        value(value)
+    {}
+
     template <typename ValueType>
     field_value::counted_impl<ValueType>::
     counted_impl(const ValueType & value) OPENVRML_THROW1(std::bad_alloc):
-        value_(new ValueType(value))
+        current_(new version(value)),
+        copying_(0)
     {}
 
     template <typename ValueType>
     field_value::counted_impl<ValueType>::
     counted_impl(const counted_impl<ValueType> & ci) OPENVRML_NOTHROW:
-        counted_impl_base()
+        counted_impl_base(),
+        current_(0),
+        copying_(0)
     {
-        using boost::shared_lock;
-        using boost::shared_mutex;
-        shared_lock<shared_mutex> lock(ci.mutex_);
-        value_ = ci.value_;
+        //
+        // While ci.copying_ is nonzero, a writer will not free any version
+        // it retires; so the version loaded here stays alive until its
+        // reference count has been incremented.
+        //
+        ++ci.copying_;
+        const version * const v = ci.current_.load();
+        v->refs.fetch_add(1, boost::memory_order_relaxed);
+        --ci.copying_;
+        this->current_.store(v, boost::memory_order_release);
     }
 
     template <typename ValueType>
     field_value::counted_impl<ValueType>::~counted_impl() OPENVRML_NOTHROW
-    {}
+    {
+        release(this->current_.load(boost::memory_order_acquire));
+        for (typename std::vector<const version *>::const_iterator v =
+                 this->retired_.begin();
+             v != this->retired_.end();
+             ++v) {
+            release(*v);
+        }
+    }
+
+    template <typename ValueType>
+    void field_value::counted_impl<ValueType>::release(const version * v)
+        OPENVRML_NOTHROW
+    {
+        if (v->refs.fetch_sub(1, boost::memory_order_release) == 1) {
+            boost::atomic_thread_fence(boost::memory_order_acquire);
+            delete v;
+        }
+    }
 
     template <typename ValueType>
     const ValueType & field_value::counted_impl<ValueType>::value() const
         OPENVRML_NOTHROW
     {
-        using boost::shared_lock;
-        using boost::shared_mutex;
-        shared_lock<shared_mutex> lock(this->mutex_);
-        assert(this->value_);
-        return *this->value_;
+        const version * const v =
+            this->current_.load(boost::memory_order_acquire);
+        assert(v);
+        return v->value;
     }
 
     template <typename ValueType>
     void field_value::counted_impl<ValueType>::value(const ValueType & val)
         OPENVRML_THROW1(std::bad_alloc)
     {
-        using boost::unique_lock;
-        using boost::shared_mutex;
-        unique_lock<shared_mutex> lock(this->mutex_);
-        assert(this->value_);
-        if (!this->value_.unique()) {
-            this->value_.reset(new ValueType(val));
-        } else {
-            *this->value_ = val;
+        std::auto_ptr<version> v(new version(val));
+        this->publish(v);
+    }
+
+    template <typename ValueType>
+    void field_value::counted_impl<ValueType>::take_value(ValueType & val)
+        OPENVRML_THROW1(std::bad_alloc)
+    {
+        std::auto_ptr<version> v(new version);
+        using std::swap;
+        swap(v->value, val);
+        try {
+            this->publish(v);
+        } catch (std::bad_alloc &) {
+            swap(v->value, val);
+            throw;
+        }
+    }
+
+    template <typename ValueType>
+    void
+    field_value::counted_impl<ValueType>::publish(std::auto_ptr<version> & v)
+        OPENVRML_THROW1(std::bad_alloc)
+    {
+        boost::lock_guard<boost::mutex> lock(write_mutex(*this));
+        this->retired_.reserve(this->retired_.size() + 1);
+        const version * const old = this->current_.exchange(v.release());
+        this->retired_.push_back(old);
+        if (this->copying_ == 0) {
+            //
+            // Hold on to the version just retired: a reference obtained
+            // from value() immediately before this write may still be in
+            // use.  Anything retired earlier can go.
+            //
+            for (std::size_t i = 0; i + 1 < this->retired_.size(); ++i) {
+                release(this->retired_[i]);
+            }
+            this->retired_.erase(this->retired_.begin(),
+                                 this->retired_.end() - 1);
         }
     }
 
@@ -257,6 +354,16 @@ namespace openvrml {
             this->counted_impl_.get())->value(val);
     }
 
+    template <typename FieldValue>
+    void field_value::take_value(typename FieldValue::value_type & val)
+        OPENVRML_THROW1(std::bad_alloc)
+    {
+        assert(this->counted_impl_.get());
+        boost::polymorphic_downcast<
+        counted_impl<typename FieldValue::value_type> *>(
+            this->counted_impl_.get())->take_value(val);
+    }
+
     template <typename FieldValue>
     void field_value::swap(FieldValue & val) OPENVRML_NOTHROW
     {
@@ -811,6 +918,7 @@ namespace openvrml {
 
         const value_type & value() const OPENVRML_NOTHROW;
         void value(const value_type & val) OPENVRML_THROW1(std::bad_alloc);
+        void take_value(value_type & val) OPENVRML_THROW1(std::bad_alloc);
         void swap(mfbool & mfc) OPENVRML_NOTHROW;
 
     private:
@@ -852,6 +960,7 @@ namespace openvrml {
 
         const value_type & value() const OPENVRML_NOTHROW;
         void value(const value_type & val) OPENVRML_THROW1(std::bad_alloc);
+        void take_value(value_type & val) OPENVRML_THROW1(std::bad_alloc);
         void swap(mfcolor & mfc) OPENVRML_NOTHROW;
 
     private:
@@ -893,6 +1002,7 @@ namespace openvrml {
 
         const value_type & value() const OPENVRML_NOTHROW;
         void value(const value_type & val) OPENVRML_THROW1(std::bad_alloc);
+        void take_value(value_type & val) OPENVRML_THROW1(std::bad_alloc);
         void swap(mfcolorrgba & mfc) OPENVRML_NOTHROW;
 
     private:
@@ -936,6 +1046,7 @@ namespace openvrml {
 
         const value_type & value() const OPENVRML_NOTHROW;
         void value(const value_type & val) OPENVRML_THROW1(std::bad_alloc);
+        void take_value(value_type & val) OPENVRML_THROW1(std::bad_alloc);
         void swap(mffloat & mff) OPENVRML_NOTHROW;
 
     private:
@@ -977,6 +1088,7 @@ namespace openvrml {
 
         const value_type & value() const OPENVRML_NOTHROW;
         void value(const value_type & val) OPENVRML_THROW1(std::bad_alloc);
+        void take_value(value_type & val) OPENVRML_THROW1(std::bad_alloc);
         void swap(mfdouble & mfd) OPENVRML_NOTHROW;
 
     private:
@@ -1018,6 +1130,7 @@ namespace openvrml {
 
         const value_type & value() const OPENVRML_NOTHROW;
         void value(const value_type & val) OPENVRML_THROW1(std::bad_alloc);
+        void take_value(value_type & val) OPENVRML_THROW1(std::bad_alloc);
         void swap(mfimage & mfi) OPENVRML_NOTHROW;
 
     private:
@@ -1057,6 +1170,7 @@ namespace openvrml {
 
         const value_type & value() const OPENVRML_NOTHROW;
         void value(const value_type & val) OPENVRML_THROW1(std::bad_alloc);
+        void take_value(value_type & val) OPENVRML_THROW1(std::bad_alloc);
         void swap(mfint32 & mfi) OPENVRML_NOTHROW;
 
     private:
@@ -1098,6 +1212,7 @@ namespace openvrml {
 
         const value_type & value() const OPENVRML_NOTHROW;
         void value(const value_type & val) OPENVRML_THROW1(std::bad_alloc);
+        void take_value(value_type & val) OPENVRML_THROW1(std::bad_alloc);
         void swap(mfnode & mfn) OPENVRML_NOTHROW;
 
     private:
@@ -1139,6 +1254,7 @@ namespace openvrml {
 
         const value_type & value() const OPENVRML_NOTHROW;
         void value(const value_type & val) OPENVRML_THROW1(std::bad_alloc);
+        void take_value(value_type & val) OPENVRML_THROW1(std::bad_alloc);
         void swap(mfrotation & mfr) OPENVRML_NOTHROW;
 
     private:
@@ -1182,6 +1298,7 @@ namespace openvrml {
 
         const value_type & value() const OPENVRML_NOTHROW;
         void value(const value_type & val) OPENVRML_THROW1(std::bad_alloc);
+        void take_value(value_type & val) OPENVRML_THROW1(std::bad_alloc);
         void swap(mfstring & mfs) OPENVRML_NOTHROW;
 
     private:
@@ -1222,6 +1339,7 @@ namespace openvrml {
 
         const value_type & value() const OPENVRML_NOTHROW;
         void value(const value_type & val) OPENVRML_THROW1(std::bad_alloc);
+        void take_value(value_type & val) OPENVRML_THROW1(std::bad_alloc);
         void swap(mftime & mft) OPENVRML_NOTHROW;
 
     private:
@@ -1263,6 +1381,7 @@ namespace openvrml {
 
         const value_type & value() const OPENVRML_NOTHROW;
         void value(const value_type & val) OPENVRML_THROW1(std::bad_alloc);
+        void take_value(value_type & val) OPENVRML_THROW1(std::bad_alloc);
         void swap(mfvec2f & mfv) OPENVRML_NOTHROW;
 
     private:
@@ -1304,6 +1423,7 @@ namespace openvrml {
 
         const value_type & value() const OPENVRML_NOTHROW;
         void value(const value_type & val) OPENVRML_THROW1(std::bad_alloc);
+        void take_value(value_type & val) OPENVRML_THROW1(std::bad_alloc);
         void swap(mfvec2d & mfv) OPENVRML_NOTHROW;
 
     private:
@@ -1345,6 +1465,7 @@ namespace openvrml {
 
         const value_type & value() const OPENVRML_NOTHROW;
         void value(const value_type & val) OPENVRML_THROW1(std::bad_alloc);
+        void take_value(value_type & val) OPENVRML_THROW1(std::bad_alloc);
         void swap(mfvec3f & mfv) OPENVRML_NOTHROW;
 
     private:
@@ -1386,6 +1507,7 @@ namespace openvrml {
 
         const value_type & value() const OPENVRML_NOTHROW;
         void value(const value_type & val) OPENVRML_THROW1(std::bad_alloc);
+        void take_value(value_type & val) OPENVRML_THROW1(std::bad_alloc);
         void swap(mfvec3d & mfv) OPENVRML_NOTHROW;
 
     private:
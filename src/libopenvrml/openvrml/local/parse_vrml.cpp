@@ -21,6 +21,8 @@
 # include "parse_vrml.h"
 # include <openvrml/x3d_vrml_grammar.h>
 # include <boost/algorithm/string/predicate.hpp>
+# include <boost/interprocess/file_mapping.hpp>
+# include <boost/interprocess/mapped_region.hpp>
 
 bool openvrml::local::anonymous_stream_id(const openvrml::local::uri & id)
 {
@@ -92,11 +94,131 @@ namespace {
     };
 }
 
+namespace {
+
+    //
+    // Parse [first, last) as media type type.  Returns false if type is
+    // not a VRML or VRML-encoded X3D media type.
+    //
+    template <typename Iterator>
+    OPENVRML_LOCAL bool
+    parse_range(Iterator & first, const Iterator & last,
+                const std::string & uri,
+                const std::string & type,
+                const openvrml::scene & scene,
+                std::vector<boost::intrusive_ptr<openvrml::node> > & nodes,
+                std::map<std::string, std::string> & meta)
+    {
+        using namespace openvrml;
+        using namespace openvrml::local;
+        using boost::algorithm::iequals;
+
+        vrml97_skip_grammar skip_g;
+
+        if (iequals(type, vrml_media_type)
+            || iequals(type, x_vrml_media_type)) {
+            parse_error error;
+            error_handler handler(scene.browser(), error);
+            vrml97_parse_actions actions(uri, scene, nodes);
+            vrml97_grammar<vrml97_parse_actions, error_handler>
+                g(actions, handler);
+
+            BOOST_SPIRIT_DEBUG_NODE(skip_g);
+            BOOST_SPIRIT_DEBUG_NODE(g);
+
+            if (!parse(first, last, g, skip_g).full) {
+                throw invalid_vrml(uri,
+                                   error.line,
+                                   error.column,
+                                   error.message);
+            }
+        } else if (iequals(type, x3d_vrml_media_type)) {
+            parse_error error;
+            error_handler handler(scene.browser(), error);
+            x3d_vrml_parse_actions actions(uri, scene, nodes, meta);
+            x3d_vrml_grammar<x3d_vrml_parse_actions, error_handler>
+                g(actions, handler);
+
+            BOOST_SPIRIT_DEBUG_NODE(skip_g);
+            BOOST_SPIRIT_DEBUG_NODE(g);
+
+            if (!parse(first, last, g, skip_g).full) {
+                throw invalid_vrml(uri,
+                                   error.line,
+                                   error.column,
+                                   error.message);
+            }
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    //
+    // Map the file identified by uri into memory.  Returns false if uri is
+    // not a local "file" URI, or if the file cannot be mapped (for
+    // instance, because it is empty); the caller should then read the
+    // stream instead.
+    //
+    OPENVRML_LOCAL bool
+    map_local_file(const std::string & uri,
+                   boost::interprocess::mapped_region & region)
+    {
+        using boost::algorithm::iequals;
+        using boost::interprocess::file_mapping;
+        using boost::interprocess::mapped_region;
+        using boost::interprocess::read_only;
+
+        std::string path;
+        try {
+            const openvrml::local::uri id(uri);
+            if (!iequals(id.scheme(), "file")) { return false; }
+            const std::string host = id.host();
+            if (!host.empty() && !iequals(host, "localhost")) {
+                return false;
+            }
+            path = id.path();
+        } catch (const openvrml::invalid_url &) {
+            return false;
+        }
+
+        //
+        // Leave percent-encoded paths to the resource_fetcher.
+        //
+        if (path.empty() || path.find('%') != std::string::npos) {
+            return false;
+        }
+
+        try {
+            const file_mapping file(path.c_str(), read_only);
+            mapped_region mapped(file, read_only);
+            region.swap(mapped);
+        } catch (const boost::interprocess::interprocess_exception &) {
+            return false;
+        }
+
+        //
+        // A gzip-compressed file is decompressed by the stream, if at all.
+        //
+        const unsigned char * const data =
+            static_cast<const unsigned char *>(region.get_address());
+        if (region.get_size() >= 2 && data[0] == 0x1f && data[1] == 0x8b) {
+            return false;
+        }
+        return true;
+    }
+}
+
 /**
  * @internal
  *
  * @brief Parse a VRML stream.
  *
+ * If @p uri is a &ldquo;file&rdquo; URI for a local file, the file is mapped
+ * into memory and parsed in place, and @p in is not read; large numeric
+ * multiple-valued field values in the file are converted on as many
+ * threads as there are processors.  Otherwise the data is read from @p in.
+ *
  * @param[in,out] in    input stream.
  * @param[in]     uri   URI associated with @p in.
  * @param[in]     type  MIME media type of the data to be read from @p in.
@@ -118,65 +240,37 @@ parse_vrml(std::istream & in,
 {
     using std::istream;
     using std::istreambuf_iterator;
-    using boost::algorithm::iequals;
     using boost::spirit::classic::multi_pass;
     using boost::spirit::classic::make_multi_pass;
     using boost::spirit::classic::position_iterator;
-    
-    typedef multi_pass<istreambuf_iterator<char> > multi_pass_iterator_t;
-    typedef istream::char_type char_t;
-
-    vrml97_skip_grammar skip_g;
-
-    if (iequals(type, vrml_media_type) || iequals(type, x_vrml_media_type)) {
-        multi_pass_iterator_t
-            in_begin(make_multi_pass(istreambuf_iterator<char_t>(in))),
-            in_end(make_multi_pass(istreambuf_iterator<char_t>()));
-
-        typedef position_iterator<multi_pass_iterator_t> iterator_t;
-
-        iterator_t first(in_begin, in_end, uri), last;
 
-        parse_error error;
-        error_handler handler(scene.browser(), error);
-        vrml97_parse_actions actions(uri, scene, nodes);
-        vrml97_grammar<vrml97_parse_actions, error_handler>
-            g(actions, handler);
+    boost::interprocess::mapped_region region;
+    if (in && map_local_file(uri, region)) {
+        const char * const begin =
+            static_cast<const char *>(region.get_address());
+        const char * const end = begin + region.get_size();
 
-        BOOST_SPIRIT_DEBUG_NODE(skip_g);
-        BOOST_SPIRIT_DEBUG_NODE(g);
+        buffer_position_iterator first(begin, begin, uri),
+            last(begin, end, uri);
 
-        if (!parse(first, last, g, skip_g).full) {
-            throw openvrml::invalid_vrml(uri,
-                                         error.line,
-                                         error.column,
-                                         error.message);
+        if (!parse_range(first, last, uri, type, scene, nodes, meta)) {
+            throw bad_media_type(type);
         }
-    } else if (iequals(type, x3d_vrml_media_type)) {
-        multi_pass_iterator_t
-            in_begin(make_multi_pass(istreambuf_iterator<char_t>(in))),
-            in_end(make_multi_pass(istreambuf_iterator<char_t>()));
+        return;
+    }
 
-        typedef position_iterator<multi_pass_iterator_t> iterator_t;
+    typedef multi_pass<istreambuf_iterator<char> > multi_pass_iterator_t;
+    typedef istream::char_type char_t;
 
-        iterator_t first(in_begin, in_end, uri), last;
+    multi_pass_iterator_t
+        in_begin(make_multi_pass(istreambuf_iterator<char_t>(in))),
+        in_end(make_multi_pass(istreambuf_iterator<char_t>()));
 
-        parse_error error;
-        error_handler handler(scene.browser(), error);
-        x3d_vrml_parse_actions actions(uri, scene, nodes, meta);
-        x3d_vrml_grammar<x3d_vrml_parse_actions, error_handler>
-            g(actions, handler);
+    typedef position_iterator<multi_pass_iterator_t> iterator_t;
 
-        BOOST_SPIRIT_DEBUG_NODE(skip_g);
-        BOOST_SPIRIT_DEBUG_NODE(g);
+    iterator_t first(in_begin, in_end, uri), last;
 
-        if (!parse(first, last, g, skip_g).full) {
-            throw openvrml::invalid_vrml(uri,
-                                         error.line,
-                                         error.column,
-                                         error.message);
-        }
-    } else {
+    if (!parse_range(first, last, uri, type, scene, nodes, meta)) {
         throw bad_media_type(type);
     }
 }
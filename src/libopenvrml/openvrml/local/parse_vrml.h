@@ -42,6 +42,23 @@ namespace openvrml {
         OPENVRML_LOCAL
         bool anonymous_stream_id(const openvrml::local::uri & id);
 
+        //
+        // Spirit passes an attribute to a semantic action by const
+        // reference; but the attribute is a temporary owned by the parser
+        // and is discarded once the action returns.  So rather than copying
+        // it, an action can take its contents.
+        //
+        template <typename MFValue>
+        const MFValue
+        take_attribute(const typename MFValue::value_type & attr)
+            OPENVRML_THROW1(std::bad_alloc)
+        {
+            MFValue result;
+            result.take_value(
+                const_cast<typename MFValue::value_type &>(attr));
+            return result;
+        }
+
         struct OPENVRML_LOCAL vrml97_parse_actions {
             vrml97_parse_actions(
                 const std::string & uri,
@@ -134,8 +151,9 @@ namespace openvrml {
                                         sfnode(ps.children.top().front()));
                             } else if (current_field_type
                                        == field_value::mfnode_id) {
-                                nd.current_field_value->second->assign(
-                                    mfnode(ps.children.top()));
+                                mfnode value;
+                                value.take_value(ps.children.top());
+                                nd.current_field_value->second->assign(value);
                             } else {
                                 assert(false);
                             }
@@ -201,8 +219,8 @@ namespace openvrml {
                     using std::vector;
 
                     assert(this->actions_.ps.top().children.size() == 1);
-                    this->actions_.nodes_ =
-                        this->actions_.ps.top().children.top();
+                    this->actions_.nodes_.swap(
+                        this->actions_.ps.top().children.top());
                     this->actions_.ps.top().children.pop();
 
                     assert(this->actions_.ps.size() == 1);
@@ -897,8 +915,10 @@ namespace openvrml {
 
                     assert(!ps.node_data_.empty());
                     assert(!ps.children.empty());
+                    mfnode value;
+                    value.take_value(ps.children.top());
                     ps.node_data_.top().current_field_value->second
-                        ->assign(mfnode(ps.children.top()));
+                        ->assign(value);
                     ps.children.pop();
                 }
 
@@ -956,7 +976,8 @@ namespace openvrml {
                     assert(!actions_.ps.empty());
                     assert(!actions_.ps.top().node_data_.empty());
                     actions_.ps.top().node_data_.top()
-                        .current_field_value->second->assign(mfcolor(val));
+                        .current_field_value->second->assign(
+                            take_attribute<mfcolor>(val));
                 }
 
             private:
@@ -994,7 +1015,8 @@ namespace openvrml {
                     assert(!actions_.ps.empty());
                     assert(!actions_.ps.top().node_data_.empty());
                     actions_.ps.top().node_data_.top()
-                        .current_field_value->second->assign(mffloat(val));
+                        .current_field_value->second->assign(
+                            take_attribute<mffloat>(val));
                 }
 
             private:
@@ -1051,7 +1073,8 @@ namespace openvrml {
                     assert(!actions_.ps.empty());
                     assert(!actions_.ps.top().node_data_.empty());
                     actions_.ps.top().node_data_.top()
-                        .current_field_value->second->assign(mfint32(val));
+                        .current_field_value->second->assign(
+                            take_attribute<mfint32>(val));
                 }
 
             private:
@@ -1089,7 +1112,8 @@ namespace openvrml {
                     assert(!actions_.ps.empty());
                     assert(!actions_.ps.top().node_data_.empty());
                     actions_.ps.top().node_data_.top()
-                        .current_field_value->second->assign(mfrotation(val));
+                        .current_field_value->second->assign(
+                            take_attribute<mfrotation>(val));
                 }
 
             private:
@@ -1127,7 +1151,8 @@ namespace openvrml {
                     assert(!actions_.ps.empty());
                     assert(!actions_.ps.top().node_data_.empty());
                     actions_.ps.top().node_data_.top()
-                        .current_field_value->second->assign(mfstring(val));
+                        .current_field_value->second->assign(
+                            take_attribute<mfstring>(val));
                 }
 
             private:
@@ -1165,7 +1190,8 @@ namespace openvrml {
                     assert(!actions_.ps.empty());
                     assert(!actions_.ps.top().node_data_.empty());
                     actions_.ps.top().node_data_.top()
-                        .current_field_value->second->assign(mftime(val));
+                        .current_field_value->second->assign(
+                            take_attribute<mftime>(val));
                 }
 
             private:
@@ -1203,7 +1229,8 @@ namespace openvrml {
                     assert(!actions_.ps.empty());
                     assert(!actions_.ps.top().node_data_.empty());
                     actions_.ps.top().node_data_.top()
-                        .current_field_value->second->assign(mfvec2f(val));
+                        .current_field_value->second->assign(
+                            take_attribute<mfvec2f>(val));
                 }
 
             private:
@@ -1241,7 +1268,8 @@ namespace openvrml {
                     assert(!actions_.ps.empty());
                     assert(!actions_.ps.top().node_data_.empty());
                     actions_.ps.top().node_data_.top()
-                        .current_field_value->second->assign(mfvec3f(val));
+                        .current_field_value->second->assign(
+                            take_attribute<mfvec3f>(val));
                 }
 
             private:
@@ -1539,7 +1567,8 @@ namespace openvrml {
                     assert(!actions_.ps.empty());
                     assert(!actions_.ps.top().node_data_.empty());
                     actions_.ps.top().node_data_.top()
-                        .current_field_value->second->assign(mfbool(val));
+                        .current_field_value->second->assign(
+                            take_attribute<mfbool>(val));
                 }
 
             private:
@@ -1558,7 +1587,8 @@ namespace openvrml {
                     assert(!actions_.ps.empty());
                     assert(!actions_.ps.top().node_data_.empty());
                     actions_.ps.top().node_data_.top()
-                        .current_field_value->second->assign(mfcolorrgba(val));
+                        .current_field_value->second->assign(
+                            take_attribute<mfcolorrgba>(val));
                 }
 
             private:
@@ -1577,7 +1607,8 @@ namespace openvrml {
                     assert(!actions_.ps.empty());
                     assert(!actions_.ps.top().node_data_.empty());
                     actions_.ps.top().node_data_.top()
-                        .current_field_value->second->assign(mfdouble(val));
+                        .current_field_value->second->assign(
+                            take_attribute<mfdouble>(val));
                 }
 
             private:
@@ -1596,7 +1627,8 @@ namespace openvrml {
                     assert(!actions_.ps.empty());
                     assert(!actions_.ps.top().node_data_.empty());
                     actions_.ps.top().node_data_.top()
-                        .current_field_value->second->assign(mfimage(val));
+                        .current_field_value->second->assign(
+                            take_attribute<mfimage>(val));
                 }
 
             private:
@@ -1615,7 +1647,8 @@ namespace openvrml {
                     assert(!actions_.ps.empty());
                     assert(!actions_.ps.top().node_data_.empty());
                     actions_.ps.top().node_data_.top()
-                        .current_field_value->second->assign(mfvec2d(val));
+                        .current_field_value->second->assign(
+                            take_attribute<mfvec2d>(val));
                 }
 
             private:
@@ -1634,7 +1667,8 @@ namespace openvrml {
                     assert(!actions_.ps.empty());
                     assert(!actions_.ps.top().node_data_.empty());
                     actions_.ps.top().node_data_.top()
-                        .current_field_value->second->assign(mfvec3d(val));
+                        .current_field_value->second->assign(
+                            take_attribute<mfvec3d>(val));
                 }
 
             private:
@@ -1145,7 +1145,7 @@ proto_node(const openvrml::node_type & type,
                 node * impl_node = resolve_node_path(path_to_impl_node,
                                                      this->impl_nodes_);
                 assert(impl_node);
-                const std::string & impl_node_interface =
+                const symbol & impl_node_interface =
                     is_mapping->second.impl_node_interface;
                 try {
                     using boost::mpl::for_each;
@@ -1181,7 +1181,7 @@ proto_node(const openvrml::node_type & type,
                 node * impl_node = resolve_node_path(path_to_impl_node,
                                                      this->impl_nodes_);
                 assert(impl_node);
-                const std::string & impl_node_interface =
+                const symbol & impl_node_interface =
                     is_mapping->second.impl_node_interface;
                 try {
                     using boost::mpl::for_each;
@@ -1226,7 +1226,7 @@ proto_node(const openvrml::node_type & type,
                 node * impl_node = resolve_node_path(path_to_impl_node,
                                                      this->impl_nodes_);
                 assert(impl_node);
-                const std::string & impl_node_interface =
+                const symbol & impl_node_interface =
                     is_mapping->second.impl_node_interface;
                 try {
                     using boost::mpl::for_each;
@@ -1314,6 +1314,11 @@ do_initialize(const double timestamp)
         (*node)->initialize(*this->scene(), timestamp);
     }
     if (!this->impl_nodes_.empty()) {
+        //
+        // Only the first implementation node is rendered; so only changes to
+        // it should propagate to the PROTO instance.
+        //
+        this->link_child(*this->impl_nodes_.front());
         this->impl_nodes_.front()->modified(true);
     }
 }
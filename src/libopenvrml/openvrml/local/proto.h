@@ -51,7 +51,7 @@ namespace openvrml {
             class is_target {
             public:
                 node * impl_node;
-                std::string impl_node_interface;
+                symbol impl_node_interface;
 
                 is_target(node & impl_node,
                           const std::string & impl_node_interface);
@@ -62,9 +62,9 @@ namespace openvrml {
             class route {
             public:
                 node * from;
-                std::string eventout;
+                symbol eventout;
                 node * to;
-                std::string eventin;
+                symbol eventin;
 
                 route(node & from, const std::string & eventout,
                       node & to, const std::string & eventin);
@@ -233,6 +233,7 @@ namespace openvrml {
 
             private:
                 const std::string do_eventout_id() const OPENVRML_NOTHROW;
+                openvrml::node * do_node() const OPENVRML_NOTHROW;
             };
 
             struct proto_eventout_creator {
@@ -650,4 +651,17 @@ do_eventout_id() const
     return pos->first;
 }
 
+/**
+ * @brief The @c PROTO instance.
+ *
+ * @return the @c PROTO instance.
+ */
+template <typename FieldValue>
+openvrml::node *
+openvrml::local::abstract_proto_node::proto_eventout<FieldValue>::do_node()
+    const OPENVRML_NOTHROW
+{
+    return &this->listener.node;
+}
+
 # endif // ifndef OPENVRML_LOCAL_PROTO_H
@@ -20,6 +20,7 @@
 //
 
 # include "browser.h"
+# include "scene.h"
 # include "scope.h"
 # include "viewer.h"
 # include <openvrml/local/node_metatype_registry_impl.h>
@@ -29,6 +30,7 @@
 # include <boost/lexical_cast.hpp>
 # include <boost/mpl/for_each.hpp>
 # include <algorithm>
+# include <limits>
 # include <sstream>
 
 # ifdef HAVE_CONFIG_H
@@ -1534,17 +1536,12 @@ openvrml::node::self_tag(new self_ref_node);
 /**
  * @internal
  *
- * @var boost::mutex openvrml::node::ref_count_mutex_
- *
- * @brief Mutex to guard @c #ref_count_.
- */
-
-/**
- * @internal
- *
- * @var size_t openvrml::node::ref_count_
+ * @var boost::detail::atomic_count openvrml::node::ref_count_
  *
  * @brief The number of owning references to the instance.
+ *
+ * The count is incremented and decremented atomically; no lock is needed to
+ * manipulate it.
  */
 
 /**
@@ -1565,6 +1562,17 @@ openvrml::node::self_tag(new self_ref_node);
  * @sa http://boost.org/libs/smart_ptr/shared_ptr.htm
  */
 
+/**
+ * @internal
+ *
+ * @var const std::string * openvrml::node::id_
+ *
+ * @brief The name of the @c node, or null if the @c node is not named.
+ *
+ * This points to the key of the @c node's entry in
+ * @c scope::named_node_map.
+ */
+
 /**
  * @internal
  *
@@ -1599,6 +1607,48 @@ openvrml::node::self_tag(new self_ref_node);
  * @sa #modified
  */
 
+/**
+ * @internal
+ *
+ * @var long openvrml::node::propagation_stamp_
+ *
+ * @brief The most recent change propagation to reach this @c node.
+ *
+ * Protected by @c #modified_mutex_.  @c #propagate uses this to visit each
+ * ancestor only once, even where @c USE makes the graph a DAG.
+ */
+
+/**
+ * @internal
+ *
+ * @var boost::shared_mutex openvrml::node::links_mutex_
+ *
+ * @brief Mutex protecting @c #parents_ and @c #linked_children_.
+ */
+
+/**
+ * @internal
+ *
+ * @var std::vector<openvrml::node *> openvrml::node::parents_
+ *
+ * @brief The <code>node</code>s that refer to this one through an
+ *        @c SFNode or @c MFNode field.
+ *
+ * A parent appears once for each reference it holds; so a @c node that is
+ * @c USE%d twice by the same parent appears twice.
+ */
+
+/**
+ * @internal
+ *
+ * @var std::vector<boost::intrusive_ptr<openvrml::node> > openvrml::node::linked_children_
+ *
+ * @brief The <code>node</code>s for which this one is in @c #parents_.
+ *
+ * Holding owning references here guarantees that no child outlives the
+ * parent's entry in the child's @c #parents_.
+ */
+
 /**
  * @brief Construct.
  *
@@ -1611,37 +1661,12 @@ openvrml::node::node(const node_type & type,
     ref_count_(0),
     type_(type),
     scope_(scope),
+    id_(0),
     scene_(0),
-    modified_(false)
+    modified_(false),
+    propagation_stamp_(0)
 {}
 
-namespace {
-
-    /**
-     * @internal
-     *
-     * @brief Map of node names to node instances.
-     */
-    typedef std::map<std::string, openvrml::node *> named_node_map_t;
-
-    struct OPENVRML_LOCAL node_is_ :
-        std::unary_function<named_node_map_t::value_type, bool> {
-
-        explicit node_is_(const openvrml::node & n):
-            n(&n)
-        {}
-
-        bool operator()(const named_node_map_t::value_type & value) const
-            OPENVRML_NOTHROW
-        {
-            return value.second == this->n;
-        }
-
-    private:
-        const openvrml::node * n;
-    };
-}
-
 /**
  * @brief Destructor.
  *
@@ -1653,27 +1678,19 @@ openvrml::node::~node() OPENVRML_NOTHROW
     // If this is the primordial node in a prototype definition, this->scope_
     // will be null.
     //
-    if (this->scope_) {
-        using std::find_if;
-        const named_node_map_t::iterator end =
-            this->scope_->named_node_map.end();
-        const named_node_map_t::iterator pos =
-            find_if(this->scope_->named_node_map.begin(), end,
-                    node_is_(*this));
-        if (pos != end) { this->scope_->named_node_map.erase(pos); }
+    if (this->scope_ && this->id_) {
+        this->scope_->named_node_map.erase(*this->id_);
     }
+    this->unlink_children();
 }
 
 /**
+ * @fn void openvrml::node::add_ref() const
+ *
  * @brief Increment the reference count.
  *
  * Add an owning reference.
  */
-void openvrml::node::add_ref() const OPENVRML_NOTHROW
-{
-    boost::mutex::scoped_lock lock(this->ref_count_mutex_);
-    ++this->ref_count_;
-}
 
 /**
  * @fn void openvrml::intrusive_ptr_add_ref(const node * n)
@@ -1701,18 +1718,11 @@ void openvrml::node::add_ref() const OPENVRML_NOTHROW
  */
 
 /**
+ * @fn void openvrml::node::release() const
+ *
  * @brief Decrement the reference count; destroy the instance if the count
  *        drops to zero.
  */
-void openvrml::node::release() const OPENVRML_NOTHROW
-{
-    bool delete_me;
-    {
-        boost::mutex::scoped_lock lock(this->ref_count_mutex_);
-        delete_me = (--this->ref_count_ == 0);
-    }
-    if (delete_me) { delete this; }
-}
 
 /**
  * @fn void openvrml::intrusive_ptr_release(const node * n)
@@ -1749,6 +1759,10 @@ const openvrml::node_type & openvrml::node::type() const OPENVRML_NOTHROW
 /**
  * @brief Set the name of the @c node.
  *
+ * If the @c node already has a name, the old name is removed from the
+ * @c scope.  If @p node_id already names another @c node in the @c scope,
+ * that @c node loses its name.
+ *
  * @param[in] node_id the name for the @c node.
  *
  * @exception std::bad_alloc    if memory allocation fails.
@@ -1756,27 +1770,34 @@ const openvrml::node_type & openvrml::node::type() const OPENVRML_NOTHROW
 void openvrml::node::id(const std::string & node_id)
     OPENVRML_THROW1(std::bad_alloc)
 {
+    typedef std::map<std::string, node *> named_node_map_t;
+
     assert(this->scope_);
-    this->scope_->named_node_map[node_id] = this; // Throws std::bad_alloc.
+    named_node_map_t & named_node_map = this->scope_->named_node_map;
+    const named_node_map_t::iterator pos =
+        named_node_map.insert(std::make_pair(node_id, this)).first;
+    if (pos->second != this) {
+        pos->second->id_ = 0;
+        pos->second = this;
+    }
+    if (this->id_ && this->id_ != &pos->first) {
+        named_node_map.erase(*this->id_);
+    }
+    this->id_ = &pos->first;
 }
 
 /**
  * @brief Retrieve the name of this @c node.
  *
+ * The @c node refers directly to its entry in the @c scope's map of named
+ * @c node%s; so this is a constant-time operation.
+ *
  * @return the @c node name.
  */
 const std::string & openvrml::node::id() const OPENVRML_NOTHROW
 {
-    using std::find_if;
-    using std::string;
-
-    assert(this->scope_);
-
-    const named_node_map_t::iterator end = this->scope_->named_node_map.end();
-    const named_node_map_t::iterator pos =
-        find_if(this->scope_->named_node_map.begin(), end, node_is_(*this));
-    static const string empty;
-    return (pos != end) ? pos->first : empty;
+    static const std::string empty;
+    return this->id_ ? *this->id_ : empty;
 }
 
 /**
@@ -1838,6 +1859,9 @@ openvrml::node::do_impl_nodes() const OPENVRML_NOTHROW
  * @p scene and @p timestamp.  If the node has already been initialized, this
  * method has no effect.
  *
+ * Each child is linked to this @c node so that changes to the child
+ * propagate upward; see @c #modified.
+ *
  * @param[in,out] scene the @c scene to which the @c node will belong.
  * @param[in] timestamp the current time.
  *
@@ -1870,12 +1894,14 @@ void openvrml::node::initialize(openvrml::scene & scene,
                     const sfnode & sfn = this->field<sfnode>(interface_->id);
                     if (sfn.value()) {
                         sfn.value()->initialize(scene, timestamp);
+                        this->link_child(*sfn.value());
                     }
                 } else if (interface_->field_type == field_value::mfnode_id) {
                     const mfnode & mfn = this->field<mfnode>(interface_->id);
                     for (size_t i = 0; i < mfn.value().size(); ++i) {
                         if (mfn.value()[i]) {
                             mfn.value()[i]->initialize(scene, timestamp);
+                            this->link_child(*mfn.value()[i]);
                         }
                     }
                 }
@@ -1992,6 +2018,93 @@ openvrml::event_emitter & openvrml::node::event_emitter(const std::string & id)
  *                                  @c eventOut is not a @p FieldValue.
  */
 
+/**
+ * @brief Generalized field accessor.
+ *
+ * @param[in] id    the interned name of the field.
+ *
+ * @return the field value.
+ *
+ * @exception unsupported_interface if the node has no field named @p id.
+ * @exception std::bad_alloc        if memory allocation fails.
+ */
+std::auto_ptr<openvrml::field_value>
+openvrml::node::field(const symbol & id) const
+    OPENVRML_THROW2(unsupported_interface, std::bad_alloc)
+{
+    return this->do_field(id).clone();
+}
+
+/**
+ * @fn const FieldValue openvrml::node::field(const symbol & id) const
+ *
+ * @brief Generalized field accessor.
+ *
+ * @tparam FieldValue   a @link FieldValueConcept Field Value@endlink.
+ *
+ * @param[in] id    the interned name of the @c field.
+ *
+ * @return the field value.
+ *
+ * @exception unsupported_interface if the node has no field named @p id.
+ * @exception std::bad_cast         if the node's @p id field is not a
+ *                                  @p FieldValue.
+ */
+
+/**
+ * @brief Get an event listener.
+ *
+ * @param[in] id    an interned @c eventIn identifier.
+ *
+ * @exception unsupported_interface if the @c node has no @c eventIn @p id.
+ */
+openvrml::event_listener & openvrml::node::event_listener(const symbol & id)
+    OPENVRML_THROW1(unsupported_interface)
+{
+    return this->do_event_listener(id);
+}
+
+/**
+ * @fn openvrml::field_value_listener<FieldValue> & openvrml::node::event_listener(const symbol & id)
+ *
+ * @brief Get an event listener.
+ *
+ * @tparam FieldValue   a @link FieldValueConcept Field Value@endlink.
+ *
+ * @param[in] id    an interned @c eventIn identifier.
+ *
+ * @exception unsupported_interface if the @c node has no @c eventIn @p id.
+ * @exception std::bad_cast         if the <code>node</code>'s @p id
+ *                                  @c eventIn is not a @p FieldValue.
+ */
+
+/**
+ * @brief Get an event emitter.
+ *
+ * @param[in] id    an interned @c eventOut identifier.
+ *
+ * @exception unsupported_interface if the node has no eventOut @p id.
+ */
+openvrml::event_emitter & openvrml::node::event_emitter(const symbol & id)
+    OPENVRML_THROW1(unsupported_interface)
+{
+    return this->do_event_emitter(id);
+}
+
+/**
+ * @fn openvrml::field_value_emitter<FieldValue> & openvrml::node::event_emitter(const symbol & id)
+ *
+ * @brief Get an event emitter.
+ *
+ * @tparam FieldValue   a @link FieldValueConcept Field Value@endlink.
+ *
+ * @param[in] id    an interned @c eventOut identifier.
+ *
+ * @exception unsupported_interface if the @c node has no @c eventOut @p id.
+ * @exception std::bad_cast         if the <code>node</code>'s @p id
+ *                                  @c eventOut is not a @p FieldValue.
+ */
+
 /**
  * @brief Shut down the node.
  *
@@ -2015,6 +2128,7 @@ void openvrml::node::shutdown(const double timestamp) OPENVRML_NOTHROW
             boost::upgrade_to_unique_lock<shared_mutex> upgraded_lock(lock);
             this->scene_ = 0;
         }
+        this->unlink_children();
 
         const node_interface_set & interfaces = this->type_.interfaces();
         for (node_interface_set::const_iterator interface_(interfaces.begin());
@@ -2392,7 +2506,10 @@ openvrml::viewpoint_node * openvrml::node::to_viewpoint() OPENVRML_NOTHROW
 /**
  * @brief Set the modified flag.
  *
- * Indicates the node needs to be revisited for rendering.
+ * Indicates the node needs to be revisited for rendering.  Setting the flag
+ * also sets it on every ancestor of the @c node, following the parent links
+ * established by @c #initialize; this takes time proportional to the number
+ * of ancestors.  Clearing the flag affects only this @c node.
  *
  * @param[in] value
  *
@@ -2404,17 +2521,21 @@ void openvrml::node::modified(const bool value)
 {
     using boost::unique_lock;
     using boost::shared_mutex;
-    unique_lock<shared_mutex> lock(this->modified_mutex_);
-    this->modified_ = value;
-    if (this->modified_) { this->type_.metatype().browser().modified(true); }
+    {
+        unique_lock<shared_mutex> lock(this->modified_mutex_);
+        this->modified_ = value;
+    }
+    if (value) {
+        this->propagate(false);
+        this->type_.metatype().browser().modified(true);
+    }
 }
 
 /**
  * @brief Determine whether the @c node has been modified.
  *
- * The default implementation returns whether this @c node has been modified.
- * Subclasses that can have child @c node%s should override this method and
- * return @c true if any of their children have been modified.
+ * Since @c #modified(bool) propagates to ancestors, this is a constant-time
+ * check of this <code>node</code>'s flag, combined with @c #do_modified.
  *
  * @return @c true if the @c node has been modified; @c false otherwise.
  *
@@ -2433,9 +2554,10 @@ bool openvrml::node::modified() const
 /**
  * @brief Determine whether the @c node has been modified.
  *
- * The default implementation returns @c false.  Subclasses that can have
- * child @c node%s should override this method and return @c true if any of
- * their children has been modified.
+ * The default implementation returns @c false.  Changes to child
+ * <code>node</code>s in @c SFNode and @c MFNode fields are propagated
+ * automatically; subclasses need override this method only to account for
+ * <code>node</code>s they hold in some other way.
  *
  * @return @c false.
  *
@@ -2447,9 +2569,260 @@ bool openvrml::node::do_modified() const
     return false;
 }
 
+/**
+ * @brief Update parent links after an @c SFNode field changes.
+ *
+ * Subclasses that change an @c SFNode field directly, rather than through
+ * an @c exposedfield, should call this so that changes to the new child
+ * continue to propagate to this @c node.  This function has no effect if the
+ * @c node has not been initialized; @c #initialize links children in that
+ * case.
+ *
+ * @param[in] old_value the field's previous value.
+ * @param[in] new_value the field's new value.
+ *
+ * @exception std::bad_alloc    if memory allocation fails.
+ */
+void openvrml::node::relink_children(const sfnode & old_value,
+                                     const sfnode & new_value)
+    OPENVRML_THROW1(std::bad_alloc)
+{
+    if (!this->scene()) { return; }
+    if (new_value.value()) { this->link_child(*new_value.value()); }
+    if (old_value.value()) { this->unlink_child(*old_value.value()); }
+}
+
+/**
+ * @brief Update parent links after an @c MFNode field changes.
+ *
+ * Subclasses that change an @c MFNode field directly, rather than through
+ * an @c exposedfield, should call this so that changes to the new children
+ * continue to propagate to this @c node.  This function has no effect if the
+ * @c node has not been initialized; @c #initialize links children in that
+ * case.
+ *
+ * @param[in] old_value the field's previous value.
+ * @param[in] new_value the field's new value.
+ *
+ * @exception std::bad_alloc    if memory allocation fails.
+ */
+void openvrml::node::relink_children(const mfnode & old_value,
+                                     const mfnode & new_value)
+    OPENVRML_THROW1(std::bad_alloc)
+{
+    if (!this->scene()) { return; }
+    typedef std::vector<boost::intrusive_ptr<node> > children_t;
+    const children_t & new_children = new_value.value();
+    for (children_t::const_iterator child = new_children.begin();
+         child != new_children.end();
+         ++child) {
+        if (*child) { this->link_child(**child); }
+    }
+    const children_t & old_children = old_value.value();
+    for (children_t::const_iterator child = old_children.begin();
+         child != old_children.end();
+         ++child) {
+        if (*child) { this->unlink_child(**child); }
+    }
+}
+
+/**
+ * @internal
+ *
+ * @fn void openvrml::node::relink_children(const field_value & old_value, const field_value & new_value)
+ *
+ * @brief Overload for fields that cannot hold <code>node</code>s; does
+ *        nothing.
+ *
+ * This lets @c exposedfield call @c #relink_children unconditionally.
+ */
+
+/**
+ * @internal
+ *
+ * @brief Make this @c node a parent of @p child.
+ *
+ * Script <code>node</code>s are not parents: their @c SFNode and @c MFNode
+ * fields are references, not part of the scene graph, and may refer to the
+ * script's own ancestors.
+ *
+ * @param[in,out] child a child @c node.
+ *
+ * @exception std::bad_alloc    if memory allocation fails.
+ */
+void openvrml::node::link_child(node & child) OPENVRML_THROW1(std::bad_alloc)
+{
+    using boost::unique_lock;
+    using boost::shared_mutex;
+
+    if (this->to_script()) { return; }
+
+    //
+    // The two locks are taken in turn rather than together so that there is
+    // no lock ordering to get wrong; propagate holds a child's lock while it
+    // takes a parent's.
+    //
+    {
+        unique_lock<shared_mutex> lock(this->links_mutex_);
+        this->linked_children_.push_back(boost::intrusive_ptr<node>(&child));
+    }
+    try {
+        unique_lock<shared_mutex> lock(child.links_mutex_);
+        child.parents_.push_back(this);
+    } catch (std::bad_alloc &) {
+        unique_lock<shared_mutex> lock(this->links_mutex_);
+        this->linked_children_.pop_back();
+        throw;
+    }
+}
+
+/**
+ * @internal
+ *
+ * @brief Remove one link between this @c node and @p child.
+ *
+ * @param[in,out] child a child @c node.
+ */
+void openvrml::node::unlink_child(node & child) OPENVRML_NOTHROW
+{
+    using std::find;
+    using boost::unique_lock;
+    using boost::shared_mutex;
+
+    boost::intrusive_ptr<node> ref;
+    {
+        unique_lock<shared_mutex> lock(this->links_mutex_);
+        const std::vector<boost::intrusive_ptr<node> >::iterator pos =
+            find(this->linked_children_.begin(),
+                 this->linked_children_.end(),
+                 &child);
+        if (pos == this->linked_children_.end()) { return; }
+        ref.swap(*pos);
+        this->linked_children_.erase(pos);
+    }
+    unique_lock<shared_mutex> lock(child.links_mutex_);
+    const std::vector<node *>::iterator pos =
+        find(child.parents_.begin(), child.parents_.end(), this);
+    assert(pos != child.parents_.end());
+    child.parents_.erase(pos);
+}
+
+/**
+ * @internal
+ *
+ * @brief Remove all of this <code>node</code>'s links to its children.
+ */
+void openvrml::node::unlink_children() OPENVRML_NOTHROW
+{
+    using std::find;
+    using boost::unique_lock;
+    using boost::shared_mutex;
+
+    std::vector<boost::intrusive_ptr<node> > children;
+    {
+        unique_lock<shared_mutex> lock(this->links_mutex_);
+        children.swap(this->linked_children_);
+    }
+    for (std::vector<boost::intrusive_ptr<node> >::const_iterator child =
+             children.begin();
+         child != children.end();
+         ++child) {
+        unique_lock<shared_mutex> lock((*child)->links_mutex_);
+        const std::vector<node *>::iterator pos =
+            find((*child)->parents_.begin(), (*child)->parents_.end(), this);
+        assert(pos != (*child)->parents_.end());
+        (*child)->parents_.erase(pos);
+    }
+}
+
+namespace {
+    boost::detail::atomic_count propagation_count(0);
+}
+
+/**
+ * @internal
+ *
+ * @brief Propagate a change to this <code>node</code>'s ancestors.
+ *
+ * @param[in] bounding_volume_dirty if @c true, mark ancestral
+ *                                  <code>bounded_volume_node</code>s'
+ *                                  bounding volumes dirty; otherwise, mark
+ *                                  ancestors modified.
+ *
+ * @exception boost::thread_resource_error  if a mutex cannot be locked.
+ */
+void openvrml::node::propagate(const bool bounding_volume_dirty)
+    OPENVRML_THROW1(boost::thread_resource_error)
+{
+    this->propagate(++propagation_count, bounding_volume_dirty);
+}
+
+/**
+ * @internal
+ *
+ * @brief Propagate a change to this <code>node</code>'s ancestors.
+ *
+ * Each propagation has a distinct @p stamp; an ancestor already bearing
+ * @p stamp has been visited along another path and is skipped.  A bounding
+ * volume change that reaches a @c node with no parents is passed on to the
+ * node's @c scene.
+ *
+ * @param[in] stamp                 the propagation identifier.
+ * @param[in] bounding_volume_dirty if @c true, mark ancestral
+ *                                  <code>bounded_volume_node</code>s'
+ *                                  bounding volumes dirty; otherwise, mark
+ *                                  ancestors modified.
+ *
+ * @exception boost::thread_resource_error  if a mutex cannot be locked.
+ */
+void openvrml::node::propagate(const long stamp,
+                               const bool bounding_volume_dirty)
+    OPENVRML_THROW1(boost::thread_resource_error)
+{
+    using boost::shared_lock;
+    using boost::unique_lock;
+    using boost::shared_mutex;
+
+    shared_lock<shared_mutex> lock(this->links_mutex_);
+    if (bounding_volume_dirty && this->parents_.empty()) {
+        //
+        // This is a root node (or a detached one); its scene caches the
+        // bounding volume of the root nodes.
+        //
+        if (openvrml::scene * const s = this->scene()) {
+            s->bounding_volume_dirty();
+        }
+    }
+    for (std::vector<node *>::const_iterator parent = this->parents_.begin();
+         parent != this->parents_.end();
+         ++parent) {
+        node & p = **parent;
+        {
+            unique_lock<shared_mutex> modified_lock(p.modified_mutex_);
+            if (p.propagation_stamp_ == stamp) { continue; }
+            p.propagation_stamp_ = stamp;
+            if (!bounding_volume_dirty) { p.modified_ = true; }
+        }
+        if (bounding_volume_dirty) {
+            bounded_volume_node * const bvn = p.to_bounded_volume();
+            if (bvn) {
+                unique_lock<shared_mutex>
+                    bv_lock(bvn->bounding_volume_dirty_mutex_);
+                bvn->bounding_volume_dirty_ = true;
+            }
+        }
+        p.propagate(stamp, bounding_volume_dirty);
+    }
+}
+
 /**
  * @brief Emit an event.
  *
+ * If the @c node that owns @p emitter is known, the event is queued on the
+ * @c browser's event cascade for the current thread and delivered
+ * breadth-first; see @c browser::queue_event.  Otherwise, the event is
+ * delivered to @p emitter's listeners immediately.
+ *
  * @param[in,out] emitter   an @c event_emitter.
  * @param[in]     timestamp the current time.
  *
@@ -2459,7 +2832,18 @@ void openvrml::node::emit_event(openvrml::event_emitter & emitter,
                                 const double timestamp)
     OPENVRML_THROW1(std::bad_alloc)
 {
-    emitter.emit_event(timestamp);
+    node * const source = emitter.do_node();
+    //
+    // A node with no owning references is being constructed or destroyed;
+    // the queue cannot hold a reference to it.
+    //
+    if (!source || source->use_count() == 0) {
+        emitter.emit_event(timestamp);
+        return;
+    }
+    source->type_.metatype().browser().queue_event(emitter,
+                                                   *source,
+                                                   timestamp);
 }
 
 /**
@@ -2616,6 +3000,62 @@ void openvrml::node::do_initialize(double)
  * @exception unsupported_interface if the node has no @c eventOut @p id.
  */
 
+/**
+ * @brief Get a field by its interned identifier.
+ *
+ * This method is called by @c #field(const symbol &) const.  The default
+ * implementation delegates to @c #do_field(const std::string &) const;
+ * subclasses that key their interfaces by @c symbol should override it.
+ *
+ * @param[in] id    field identifier.
+ *
+ * @return the field value.
+ *
+ * @exception unsupported_interface if the @c node has no @c field @p id.
+ */
+const openvrml::field_value & openvrml::node::do_field(const symbol & id) const
+    OPENVRML_THROW1(unsupported_interface)
+{
+    return this->do_field(id.name());
+}
+
+/**
+ * @brief Get an event listener by its interned identifier.
+ *
+ * This method is called by @c #event_listener(const symbol &).  The default
+ * implementation delegates to @c #do_event_listener(const std::string &).
+ *
+ * @param[in] id    @c eventIn identifier.
+ *
+ * @return the event listener.
+ *
+ * @exception unsupported_interface if the node has no @c eventIn @p id.
+ */
+openvrml::event_listener &
+openvrml::node::do_event_listener(const symbol & id)
+    OPENVRML_THROW1(unsupported_interface)
+{
+    return this->do_event_listener(id.name());
+}
+
+/**
+ * @brief Get an event emitter by its interned identifier.
+ *
+ * This method is called by @c #event_emitter(const symbol &).  The default
+ * implementation delegates to @c #do_event_emitter(const std::string &).
+ *
+ * @param[in] id    @c eventOut identifier.
+ *
+ * @return the event emitter.
+ *
+ * @exception unsupported_interface if the node has no @c eventOut @p id.
+ */
+openvrml::event_emitter & openvrml::node::do_event_emitter(const symbol & id)
+    OPENVRML_THROW1(unsupported_interface)
+{
+    return this->do_event_emitter(id.name());
+}
+
 /**
  * @brief @c node subclass-specific shut down.
  *
@@ -2670,6 +3110,24 @@ namespace {
         openvrml::event_listener * listener_;
         bool * added_route_;
     };
+
+    OPENVRML_LOCAL bool add_route_(openvrml::event_emitter & emitter,
+                                   openvrml::event_listener & listener)
+        OPENVRML_THROW2(std::bad_alloc, openvrml::field_value_type_mismatch)
+    {
+        using std::bad_cast;
+        bool added_route = false;
+        try {
+            using boost::mpl::for_each;
+            using openvrml::local::field_value_types;
+            for_each<field_value_types>(add_listener(emitter,
+                                                     listener,
+                                                     added_route));
+        } catch (const bad_cast &) {
+            throw openvrml::field_value_type_mismatch();
+        }
+        return added_route;
+    }
 }
 
 /**
@@ -2702,21 +3160,41 @@ bool openvrml::add_route(node & from,
     OPENVRML_THROW3(std::bad_alloc, unsupported_interface,
                     field_value_type_mismatch)
 {
-    using std::bad_cast;
+    return add_route_(from.event_emitter(eventout),
+                      to.event_listener(eventin));
+}
 
-    event_emitter & emitter = from.event_emitter(eventout);
-    event_listener & listener = to.event_listener(eventin);
-    bool added_route = false;
-    try {
-        using boost::mpl::for_each;
-        using openvrml::local::field_value_types;
-        for_each<field_value_types>(add_listener(emitter,
-                                                 listener,
-                                                 added_route));
-    } catch (const bad_cast &) {
-        throw field_value_type_mismatch();
-    }
-    return added_route;
+/**
+ * @brief Add a route from an @c eventOut of this node to an @c eventIn of
+ *        another node.
+ *
+ * This overload avoids string lookups when the interface identifiers have
+ * already been interned.
+ *
+ * @param[in,out] from      source node.
+ * @param[in]     eventout  an eventOut of @p from.
+ * @param[in,out] to        destination node.
+ * @param[in]     eventin   an eventIn of @p to.
+ *
+ * @return @c true if a route was successfully added; @c false otherwise (if
+ *         the route already existed).
+ *
+ * @exception std::bad_alloc            if memory allocation fails.
+ * @exception unsupported_interface     if @p from has no eventOut
+ *                                      @p eventout; or if @p to has no
+ *                                      eventIn @p eventin.
+ * @exception field_value_type_mismatch if @p eventout and @p eventin have
+ *                                      different field value types.
+ */
+bool openvrml::add_route(node & from,
+                         const symbol & eventout,
+                         node & to,
+                         const symbol & eventin)
+    OPENVRML_THROW3(std::bad_alloc, unsupported_interface,
+                    field_value_type_mismatch)
+{
+    return add_route_(from.event_emitter(eventout),
+                      to.event_listener(eventin));
 }
 
 namespace {
@@ -2745,6 +3223,26 @@ namespace {
         openvrml::event_listener * listener_;
         bool * deleted_route_;
     };
+
+    OPENVRML_LOCAL bool delete_route_(openvrml::event_emitter & emitter,
+                                      openvrml::event_listener & listener)
+        OPENVRML_THROW1(std::bad_alloc)
+    {
+        using std::bad_cast;
+        bool deleted_route = false;
+        try {
+            using boost::mpl::for_each;
+            using openvrml::local::field_value_types;
+            for_each<field_value_types>(remove_listener(emitter,
+                                                        listener,
+                                                        deleted_route));
+        } catch (const bad_cast &) {
+            //
+            // Do nothing.  If route removal fails, we simply return false.
+            //
+        }
+        return deleted_route;
+    }
 }
 
 /**
@@ -2759,6 +3257,7 @@ namespace {
  * @return @c true if a route was deleted; @c false otherwise (if no such route
  *         existed).
  *
+ * @exception std::bad_alloc          if memory allocation fails.
  * @exception unsupported_interface if @p from has no @c eventOut @p eventout
  *                                  or if @p to has no @c eventIn @p eventin.
  */
@@ -2766,25 +3265,39 @@ bool openvrml::delete_route(node & from,
                             const std::string & eventout,
                             node & to,
                             const std::string & eventin)
-    OPENVRML_THROW1(unsupported_interface)
+    OPENVRML_THROW2(std::bad_alloc, unsupported_interface)
 {
-    using std::bad_cast;
+    return delete_route_(from.event_emitter(eventout),
+                         to.event_listener(eventin));
+}
 
-    event_emitter & emitter = from.event_emitter(eventout);
-    event_listener & listener = to.event_listener(eventin);
-    bool deleted_route = false;
-    try {
-        using boost::mpl::for_each;
-        using openvrml::local::field_value_types;
-        for_each<field_value_types>(remove_listener(emitter,
-                                                    listener,
-                                                    deleted_route));
-    } catch (const bad_cast &) {
-        //
-        // Do nothing.  If route removal fails, we simply return false.
-        //
-    }
-    return deleted_route;
+/**
+ * @brief Remove a route from an @c eventOut from a @c node to an @c eventIn
+ *        of another @c node.
+ *
+ * This overload avoids string lookups when the interface identifiers have
+ * already been interned.
+ *
+ * @param[in,out] from      source @c node.
+ * @param[in]     eventout  an @c eventOut of @p from.
+ * @param[in,out] to        destination @c node.
+ * @param[in]     eventin   an @c eventIn of @p to.
+ *
+ * @return @c true if a route was deleted; @c false otherwise (if no such route
+ *         existed).
+ *
+ * @exception std::bad_alloc          if memory allocation fails.
+ * @exception unsupported_interface if @p from has no @c eventOut @p eventout
+ *                                  or if @p to has no @c eventIn @p eventin.
+ */
+bool openvrml::delete_route(node & from,
+                            const symbol & eventout,
+                            node & to,
+                            const symbol & eventin)
+    OPENVRML_THROW2(std::bad_alloc, unsupported_interface)
+{
+    return delete_route_(from.event_emitter(eventout),
+                         to.event_listener(eventin));
 }
 
 
@@ -3192,8 +3705,9 @@ openvrml::bounded_volume_node::do_bounding_volume() const
  *
  * Indicate that a node's bounding volume needs to be recalculated (or not).
  * If a node's bounding volume is invalid, then the bounding volumes of all
- * that node's ancestors are also invalid. Normally, the node itself will
- * determine when its bounding volume needs updating.
+ * that node's ancestors are also invalid; setting the flag marks them
+ * accordingly.  Normally, the node itself will determine when its bounding
+ * volume needs updating.
  *
  * @param[in] value @c true if the node's bounding volume should be
  *                  recalculated; @c false otherwise.
@@ -3202,11 +3716,11 @@ void openvrml::bounded_volume_node::bounding_volume_dirty(const bool value)
 {
     using boost::unique_lock;
     using boost::shared_mutex;
-    unique_lock<shared_mutex> lock(this->bounding_volume_dirty_mutex_);
-    this->bounding_volume_dirty_ = value;
-    if (value) { // only if dirtying, not clearing
-        this->type().metatype().browser().flags_need_updating = true;
+    {
+        unique_lock<shared_mutex> lock(this->bounding_volume_dirty_mutex_);
+        this->bounding_volume_dirty_ = value;
     }
+    if (value) { this->propagate(true); } // only if dirtying, not clearing
 }
 
 /**
@@ -3220,10 +3734,6 @@ bool openvrml::bounded_volume_node::bounding_volume_dirty() const
     using boost::shared_lock;
     using boost::shared_mutex;
     shared_lock<shared_mutex> lock(this->bounding_volume_dirty_mutex_);
-    if (this->type().metatype().browser().flags_need_updating) {
-        this->type().metatype().browser().update_flags();
-        this->type().metatype().browser().flags_need_updating = false;
-    }
     return this->bounding_volume_dirty_;
 }
 
@@ -5198,6 +5708,52 @@ void openvrml::time_dependent_node::update(double time)
  * @param[in] time  the current time.
  */
 
+/**
+ * @brief The time at which the @c node next needs to be updated.
+ *
+ * @c browser::update calls @c #update only once the current time has reached
+ * this time.  It asks again after each update, and when the @c node calls
+ * @c #reschedule.
+ *
+ * This function delegates to @c #do_next_update_time.
+ *
+ * @return the time at which the @c node next needs to be updated.
+ */
+double openvrml::time_dependent_node::next_update_time() const
+{
+    return this->do_next_update_time();
+}
+
+/**
+ * @brief Called by @c #next_update_time.
+ *
+ * The default implementation returns negative infinity, so that the @c node
+ * is updated every time the @c browser is.  A @c node that is idle until
+ * some known time should return that time; one that is idle until it
+ * receives an event should return infinity and call @c #reschedule from the
+ * event handler.
+ *
+ * @return negative infinity.
+ */
+double openvrml::time_dependent_node::do_next_update_time() const
+{
+    return -std::numeric_limits<double>::infinity();
+}
+
+/**
+ * @brief Tell the @c browser that @c #next_update_time has changed.
+ *
+ * A @c node must call this when an event makes its next update time
+ * earlier.  It need not do so from @c #do_update; the @c browser asks for
+ * the next update time after each update anyway.
+ */
+void openvrml::time_dependent_node::reschedule()
+{
+    if (this->scene()) {
+        this->type().metatype().browser().reschedule(*this);
+    }
+}
+
 /**
  * @brief Cast to a @c time_dependent_node.
  *
@@ -24,7 +24,9 @@
 
 #   include <openvrml/field_value.h>
 #   include <openvrml/rendering_context.h>
+#   include <openvrml/symbol.h>
 #   include <boost/bind.hpp>
+#   include <boost/detail/atomic_count.hpp>
 #   include <deque>
 #   include <map>
 #   include <set>
@@ -462,17 +464,24 @@ namespace openvrml {
         template <typename FieldValue>
         friend class exposedfield;
 
-        mutable boost::mutex ref_count_mutex_;
-        mutable size_t ref_count_;
+        friend class bounded_volume_node;
+
+        mutable boost::detail::atomic_count ref_count_;
 
         const node_type & type_;
         const boost::shared_ptr<openvrml::scope> scope_;
+        const std::string * id_;
 
         mutable boost::shared_mutex scene_mutex_;
         openvrml::scene * scene_;
 
         mutable boost::shared_mutex modified_mutex_;
         bool modified_;
+        long propagation_stamp_;
+
+        mutable boost::shared_mutex links_mutex_;
+        std::vector<node *> parents_;
+        std::vector<boost::intrusive_ptr<node> > linked_children_;
 
     public:
         static const boost::intrusive_ptr<node> self_tag;
@@ -525,6 +534,28 @@ namespace openvrml {
         template <typename FieldValue>
         field_value_emitter<FieldValue> & event_emitter(const std::string & id)
             OPENVRML_THROW2(unsupported_interface, std::bad_cast);
+
+        std::auto_ptr<field_value> field(const symbol & id) const
+            OPENVRML_THROW2(unsupported_interface, std::bad_alloc);
+
+        template <typename FieldValue>
+        const FieldValue field(const symbol & id) const
+            OPENVRML_THROW2(unsupported_interface, std::bad_cast);
+
+        openvrml::event_listener & event_listener(const symbol & id)
+            OPENVRML_THROW1(unsupported_interface);
+
+        template <typename FieldValue>
+        field_value_listener<FieldValue> & event_listener(const symbol & id)
+            OPENVRML_THROW2(unsupported_interface, std::bad_cast);
+
+        openvrml::event_emitter & event_emitter(const symbol & id)
+            OPENVRML_THROW1(unsupported_interface);
+
+        template <typename FieldValue>
+        field_value_emitter<FieldValue> & event_emitter(const symbol & id)
+            OPENVRML_THROW2(unsupported_interface, std::bad_cast);
+
         void shutdown(double timestamp) OPENVRML_NOTHROW;
 
         bool modified() const OPENVRML_THROW1(boost::thread_resource_error);
@@ -541,7 +572,24 @@ namespace openvrml {
 
         boost::shared_mutex & scene_mutex();
 
+        void relink_children(const sfnode & old_value,
+                             const sfnode & new_value)
+            OPENVRML_THROW1(std::bad_alloc);
+        void relink_children(const mfnode & old_value,
+                             const mfnode & new_value)
+            OPENVRML_THROW1(std::bad_alloc);
+
     private:
+        void relink_children(const field_value & old_value,
+                             const field_value & new_value) OPENVRML_NOTHROW;
+        void link_child(node & child) OPENVRML_THROW1(std::bad_alloc);
+        void unlink_child(node & child) OPENVRML_NOTHROW;
+        void unlink_children() OPENVRML_NOTHROW;
+        void propagate(bool bounding_volume_dirty)
+            OPENVRML_THROW1(boost::thread_resource_error);
+        void propagate(long stamp, bool bounding_volume_dirty)
+            OPENVRML_THROW1(boost::thread_resource_error);
+
         virtual
         const std::vector<boost::intrusive_ptr<node> > & do_impl_nodes() const
             OPENVRML_NOTHROW;
@@ -562,6 +610,14 @@ namespace openvrml {
         virtual openvrml::event_emitter &
         do_event_emitter(const std::string & id)
             OPENVRML_THROW1(unsupported_interface) = 0;
+
+        virtual const field_value & do_field(const symbol & id) const
+            OPENVRML_THROW1(unsupported_interface);
+        virtual openvrml::event_listener & do_event_listener(const symbol & id)
+            OPENVRML_THROW1(unsupported_interface);
+        virtual openvrml::event_emitter & do_event_emitter(const symbol & id)
+            OPENVRML_THROW1(unsupported_interface);
+
         virtual void do_shutdown(double timestamp) OPENVRML_NOTHROW;
 
         virtual bool do_modified() const
@@ -596,19 +652,33 @@ namespace openvrml {
         virtual viewpoint_node * to_viewpoint() OPENVRML_NOTHROW;
     };
 
+    inline void node::add_ref() const OPENVRML_NOTHROW
+    {
+        ++this->ref_count_;
+    }
+
     inline void intrusive_ptr_add_ref(const node * n) OPENVRML_NOTHROW
     {
         assert(n);
         n->add_ref();
     }
 
+    inline void node::relink_children(const field_value &,
+                                      const field_value &) OPENVRML_NOTHROW
+    {}
+
     inline void node::remove_ref() const OPENVRML_NOTHROW
     {
-        boost::mutex::scoped_lock lock(this->ref_count_mutex_);
         assert(this->ref_count_ > 0);
         --this->ref_count_;
     }
 
+    inline void node::release() const OPENVRML_NOTHROW
+    {
+        assert(this->ref_count_ > 0);
+        if (--this->ref_count_ == 0) { delete this; }
+    }
+
     inline void intrusive_ptr_release(const node * n) OPENVRML_NOTHROW
     {
         assert(n);
@@ -657,6 +727,30 @@ namespace openvrml {
             this->do_event_emitter(id));
     }
 
+    template <typename FieldValue>
+    const FieldValue node::field(const symbol & id) const
+        OPENVRML_THROW2(unsupported_interface, std::bad_cast)
+    {
+        boost::function_requires<FieldValueConcept<FieldValue> >();
+        return dynamic_cast<const FieldValue &>(this->do_field(id));
+    }
+
+    template <typename FieldValue>
+    field_value_listener<FieldValue> & node::event_listener(const symbol & id)
+        OPENVRML_THROW2(unsupported_interface, std::bad_cast)
+    {
+        return dynamic_cast<field_value_listener<FieldValue> &>(
+            this->do_event_listener(id));
+    }
+
+    template <typename FieldValue>
+    field_value_emitter<FieldValue> & node::event_emitter(const symbol & id)
+        OPENVRML_THROW2(unsupported_interface, std::bad_cast)
+    {
+        return dynamic_cast<field_value_emitter<FieldValue> &>(
+            this->do_event_emitter(id));
+    }
+
     OPENVRML_API bool is_proto_instance(const node & n);
 
     OPENVRML_API bool add_route(node & from, const std::string & eventout,
@@ -666,7 +760,16 @@ namespace openvrml {
 
     OPENVRML_API bool delete_route(node & from, const std::string & eventout,
                                    node & to, const std::string & eventin)
-        OPENVRML_THROW1(unsupported_interface);
+        OPENVRML_THROW2(std::bad_alloc, unsupported_interface);
+
+    OPENVRML_API bool add_route(node & from, const symbol & eventout,
+                                node & to, const symbol & eventin)
+        OPENVRML_THROW3(std::bad_alloc, unsupported_interface,
+                        field_value_type_mismatch);
+
+    OPENVRML_API bool delete_route(node & from, const symbol & eventout,
+                                   node & to, const symbol & eventin)
+        OPENVRML_THROW2(std::bad_alloc, unsupported_interface);
 
     template <>
     inline script_node * node_cast<script_node *>(node * n) OPENVRML_NOTHROW
@@ -910,6 +1013,8 @@ namespace openvrml {
 
 
     class OPENVRML_API bounded_volume_node : public virtual node {
+        friend class node;
+
         mutable boost::shared_mutex bounding_volume_dirty_mutex_;
         mutable bool bounding_volume_dirty_;
 
@@ -1358,16 +1463,20 @@ namespace openvrml {
         virtual ~time_dependent_node() OPENVRML_NOTHROW = 0;
 
         void update(double time);
+        double next_update_time() const;
 
     protected:
         time_dependent_node(const node_type & type,
                             const boost::shared_ptr<openvrml::scope> & scope)
             OPENVRML_NOTHROW;
 
+        void reschedule();
+
     private:
         virtual time_dependent_node * to_time_dependent() OPENVRML_NOTHROW;
 
         virtual void do_update(double time) = 0;
+        virtual double do_next_update_time() const;
     };
 
 
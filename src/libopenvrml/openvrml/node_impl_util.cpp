@@ -440,6 +440,55 @@ openvrml::node_impl_util::abstract_node_type::~abstract_node_type()
  */
 
 
+/**
+ * @fn const openvrml::field_value & openvrml::node_impl_util::abstract_node_type::field_value(const openvrml::node & node, const openvrml::symbol & id) const
+ *
+ * @brief @p node's @c openvrml::field_value corresponding to the interned
+ *        @c field identifier @p id.
+ *
+ * @param[in] node  the @c openvrml::node for which to return the
+ *                  @c openvrml::field_value.
+ * @param[in] id    interned @c field identifier.
+ *
+ * @return @p node's @c openvrml::field_value corresponding to @p id.
+ *
+ * @exception openvrml::unsupported_interface   if @p node has no @c field
+ *                                              @p id.
+ */
+
+/**
+ * @fn openvrml::event_listener & openvrml::node_impl_util::abstract_node_type::event_listener(openvrml::node & node, const openvrml::symbol & id) const
+ *
+ * @brief @p node's @c openvrml::event_listener corresponding to the interned
+ *        @c eventIn identifier @p id.
+ *
+ * @param[in] node  the @c openvrml::node for which to return the
+ *                  @c openvrml::event_listener.
+ * @param[in] id    interned @c eventIn identifier.
+ *
+ * @return @p node's @c openvrml::event_listener corresponding to @p id.
+ *
+ * @exception openvrml::unsupported_interface   if @p node has no @c eventIn
+ *                                              @p id.
+ */
+
+/**
+ * @fn openvrml::event_emitter & openvrml::node_impl_util::abstract_node_type::event_emitter(openvrml::node & node, const openvrml::symbol & id) const
+ *
+ * @brief @p node's @c openvrml::event_emitter corresponding to the interned
+ *        @c eventOut identifier @p id.
+ *
+ * @param[in] node  the @c openvrml::node for which to return the
+ *                  @c openvrml::event_emitter.
+ * @param[in] id    interned @c eventOut identifier.
+ *
+ * @return @p node's @c openvrml::event_emitter corresponding to @p id.
+ *
+ * @exception openvrml::unsupported_interface   if @p node has no @c eventOut
+ *                                              @p id.
+ */
+
+
 /**
  * @class openvrml::node_impl_util::node_type_impl openvrml/node_impl_util.h
  *
@@ -502,7 +551,7 @@ openvrml::node_impl_util::abstract_node_type::~abstract_node_type()
 /**
  * @internal
  *
- * @typedef std::map<std::string, openvrml::node_impl_util::node_type_impl<Node>::field_ptr_ptr> openvrml::node_impl_util::node_type_impl<Node>::field_value_map_t
+ * @typedef std::map<openvrml::symbol, openvrml::node_impl_util::node_type_impl<Node>::field_ptr_ptr> openvrml::node_impl_util::node_type_impl<Node>::field_value_map_t
  *
  * @brief Map of pointers to @c openvrml::field_value node
  *        members.
@@ -511,7 +560,7 @@ openvrml::node_impl_util::abstract_node_type::~abstract_node_type()
 /**
  * @internal
  *
- * @typedef std::map<std::string, openvrml::node_impl_util::node_type_impl<Node>::event_listener_ptr_ptr> openvrml::node_impl_util::node_type_impl<Node>::event_listener_map_t
+ * @typedef std::map<openvrml::symbol, openvrml::node_impl_util::node_type_impl<Node>::event_listener_ptr_ptr> openvrml::node_impl_util::node_type_impl<Node>::event_listener_map_t
  *
  * @brief Map of pointers to @c openvrml::event_listener node
  *        members.
@@ -520,7 +569,7 @@ openvrml::node_impl_util::abstract_node_type::~abstract_node_type()
 /**
  * @internal
  *
- * @typedef std::map<std::string, openvrml::node_impl_util::node_type_impl<Node>::event_emitter_ptr_ptr> openvrml::node_impl_util::node_type_impl<Node>::event_emitter_map_t
+ * @typedef std::map<openvrml::symbol, openvrml::node_impl_util::node_type_impl<Node>::event_emitter_ptr_ptr> openvrml::node_impl_util::node_type_impl<Node>::event_emitter_map_t
  *
  * @brief Map of pointers to @c openvrml::event_emitter node
  *        members.
@@ -553,6 +602,30 @@ openvrml::node_impl_util::abstract_node_type::~abstract_node_type()
  *        members.
  */
 
+/**
+ * @internal
+ *
+ * @var openvrml::node_impl_util::node_type_impl<Node>::event_listener_map_t openvrml::node_impl_util::node_type_impl<Node>::event_listener_alias_map
+ *
+ * @brief Alternative names for entries in @c #event_listener_map.
+ *
+ * An @c eventIn @c set_foo (including the @c eventIn of an
+ * @c exposedField @c foo) may also be addressed as @c foo.  Keeping these
+ * aliases apart from @c #event_listener_map means that map still has
+ * exactly one entry per @c eventIn.
+ */
+
+/**
+ * @internal
+ *
+ * @var openvrml::node_impl_util::node_type_impl<Node>::event_emitter_map_t openvrml::node_impl_util::node_type_impl<Node>::event_emitter_alias_map
+ *
+ * @brief Alternative names for entries in @c #event_emitter_map.
+ *
+ * An @c eventOut @c foo_changed (including the @c eventOut of an
+ * @c exposedField @c foo) may also be addressed as @c foo.
+ */
+
 
 /**
  * @class openvrml::node_impl_util::event_listener_base openvrml/node_impl_util.h
@@ -632,11 +705,22 @@ openvrml::node_impl_util::abstract_node_type::~abstract_node_type()
  * @brief Destroy.
  */
 
+/**
+ * @internal
+ *
+ * @var boost::atomic<openvrml::symbol> openvrml::node_impl_util::event_listener_base::eventin_id_
+ *
+ * @brief The associated @c eventIn identifier, once it has been resolved.
+ */
+
 /**
  * @fn const std::string openvrml::node_impl_util::event_listener_base::do_eventin_id() const
  *
  * @brief The associated @c eventIn identifier.
  *
+ * The identifier is resolved by searching the @c node_type_impl's table on
+ * the first call and cached thereafter.
+ *
  * @return the associated @c eventIn identifier.
  */
 
@@ -647,7 +731,8 @@ openvrml::node_impl_util::abstract_node_type::~abstract_node_type()
  * @brief Abstract base for @c event_emitter implementations.
  *
  * @c event_emitter_base implements
- * @c openvrml::event_emitter::do_eventout_id.
+ * @c openvrml::event_emitter::do_eventout_id and
+ * @c openvrml::event_emitter::do_node.
  *
  * @tparam Node a concrete node type.
  */
@@ -737,6 +822,14 @@ openvrml::node_impl_util::abstract_node_type::~abstract_node_type()
  * @brief The node with which the @c event_emitter is associated.
  */
 
+/**
+ * @internal
+ *
+ * @var boost::atomic<openvrml::symbol> openvrml::node_impl_util::event_emitter_base::eventout_id_
+ *
+ * @brief The associated @c eventOut identifier, once it has been resolved.
+ */
+
 /**
  * @fn const std::string openvrml::node_impl_util::event_emitter_base::do_eventout_id() const
  *
@@ -745,6 +838,14 @@ openvrml::node_impl_util::abstract_node_type::~abstract_node_type()
  * @return the associated @c eventOut identifier.
  */
 
+/**
+ * @fn openvrml::node * openvrml::node_impl_util::event_emitter_base::do_node() const
+ *
+ * @brief The @c node with which the @c event_emitter is associated.
+ *
+ * @return the @c node with which the @c event_emitter is associated.
+ */
+
 
 /**
  * @class openvrml::node_impl_util::abstract_node openvrml/node_impl_util.h
@@ -1131,6 +1232,14 @@ openvrml::node_impl_util::abstract_node_type::~abstract_node_type()
  * @brief Polymorphically construct a copy.
  */
 
+/**
+ * @fn openvrml::node * openvrml::node_impl_util::abstract_node::exposedfield::do_node() const
+ *
+ * @brief The @c node that emits events through this emitter.
+ *
+ * @return the @c node that emits events through this emitter.
+ */
+
 /**
  * @var openvrml::node_impl_util::abstract_node::metadata
  *
@@ -1190,6 +1299,44 @@ openvrml::node_impl_util::abstract_node_type::~abstract_node_type()
  * @exception unsupported_interface if the @c node has no @c eventOut @p id.
  */
 
+/**
+ * @fn const openvrml::field_value & openvrml::node_impl_util::abstract_node::do_field(const symbol & id) const
+ *
+ * @brief Get a field value for a node.
+ *
+ * @param[in] id    interned field name.
+ *
+ * @exception unsupported_interface  if the node has no field @p id.
+ */
+
+/**
+ * @fn openvrml::event_listener & openvrml::node_impl_util::abstract_node::do_event_listener(const symbol & id)
+ *
+ * @brief Get an event listener.
+ *
+ * This method is called by @c node::event_listener(const symbol &).
+ *
+ * @param[in] id    interned @c eventIn identifier.
+ *
+ * @return the event listener.
+ *
+ * @exception unsupported_interface if the @c node has no @c eventIn @p id.
+ */
+
+/**
+ * @fn openvrml::event_emitter & openvrml::node_impl_util::abstract_node::do_event_emitter(const symbol & id)
+ *
+ * @brief Get an event emitter.
+ *
+ * This method is called by @c node::event_emitter(const symbol &).
+ *
+ * @param[in] id    interned @c eventOut identifier.
+ *
+ * @return the event emitter.
+ *
+ * @exception unsupported_interface if the @c node has no @c eventOut @p id.
+ */
+
 /**
  * @class openvrml::node_impl_util::node_type_impl::field_ptr openvrml/node_impl_util.h
  *
@@ -1429,7 +1576,23 @@ openvrml::node_impl_util::abstract_node_type::~abstract_node_type()
  */
 
 /**
- * @fn const openvrml::field_value & openvrml::node_impl_util::node_type_impl::do_field_value(const Node & node, const std::string & id) const
+ * @fn const openvrml::field_value & openvrml::node_impl_util::node_type_impl::field_value(const openvrml::node & node, const openvrml::symbol & id) const
+ *
+ * @brief @p node's @c openvrml::field_value corresponding to the interned
+ *        @c field identifier @p id.
+ *
+ * @param[in] node  the @c openvrml::node for which to return the
+ *                  @c openvrml::field_value.
+ * @param[in] id    interned @c field identifier.
+ *
+ * @return @p node's @c openvrml::field_value corresponding to @p id.
+ *
+ * @exception openvrml::unsupported_interface   if @p node has no @c field
+ *                                              @p id.
+ */
+
+/**
+ * @fn const openvrml::field_value & openvrml::node_impl_util::node_type_impl::do_field_value(const Node & node, const openvrml::symbol & id) const
  *
  * @brief @p node's @c openvrml::field_value corresponding to the
  *        field identifier @p id.
@@ -1466,7 +1629,23 @@ openvrml::node_impl_util::abstract_node_type::~abstract_node_type()
  */
 
 /**
- * @fn openvrml::event_listener & openvrml::node_impl_util::node_type_impl::do_event_listener(Node & node, const std::string & id) const
+ * @fn openvrml::event_listener & openvrml::node_impl_util::node_type_impl::event_listener(openvrml::node & node, const openvrml::symbol & id) const
+ *
+ * @brief @p node's @c openvrml::event_listener corresponding to the interned
+ *        @c eventIn identifier @p id.
+ *
+ * @param[in] node  the @c openvrml::node for which to return the
+ *                  @c openvrml::event_listener.
+ * @param[in] id    interned @c eventIn identifier.
+ *
+ * @return @p node's @c openvrml::event_listener corresponding to @p id.
+ *
+ * @exception openvrml::unsupported_interface   if @p node has no @c eventIn
+ *                                              @p id.
+ */
+
+/**
+ * @fn openvrml::event_listener & openvrml::node_impl_util::node_type_impl::do_event_listener(Node & node, const openvrml::symbol & id) const
  *
  * @brief @p node's @c openvrml::event_listener corresponding to
  *        the @c eventIn identifier @p id.
@@ -1502,7 +1681,23 @@ openvrml::node_impl_util::abstract_node_type::~abstract_node_type()
  */
 
 /**
- * @fn openvrml::event_emitter & openvrml::node_impl_util::node_type_impl::do_event_emitter(Node & node, const std::string & id) const
+ * @fn openvrml::event_emitter & openvrml::node_impl_util::node_type_impl::event_emitter(openvrml::node & node, const openvrml::symbol & id) const
+ *
+ * @brief @p node's @c openvrml::event_emitter corresponding to the interned
+ *        @c eventOut identifier @p id.
+ *
+ * @param[in] node  the @c openvrml::node for which to return the
+ *                  @c openvrml::event_emitter.
+ * @param[in] id    interned @c eventOut identifier.
+ *
+ * @return @p node's @c openvrml::event_emitter corresponding to @p id.
+ *
+ * @exception openvrml::unsupported_interface   if @p node has no @c eventOut
+ *                                              @p id.
+ */
+
+/**
+ * @fn openvrml::event_emitter & openvrml::node_impl_util::node_type_impl::do_event_emitter(Node & node, const openvrml::symbol & id) const
  *
  * @brief @p node's @c openvrml::event_emitter corresponding to
  *        the @c eventOut identifier @p id.
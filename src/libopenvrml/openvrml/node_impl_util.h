@@ -185,6 +185,19 @@ namespace openvrml {
             event_emitter(openvrml::node & node, const std::string & id) const
                 OPENVRML_THROW1(openvrml::unsupported_interface) = 0;
 
+            virtual const openvrml::field_value &
+            field_value(const openvrml::node & node,
+                        const openvrml::symbol & id) const
+                OPENVRML_THROW1(openvrml::unsupported_interface) = 0;
+            virtual openvrml::event_listener &
+            event_listener(openvrml::node & node,
+                           const openvrml::symbol & id) const
+                OPENVRML_THROW1(openvrml::unsupported_interface) = 0;
+            virtual openvrml::event_emitter &
+            event_emitter(openvrml::node & node,
+                          const openvrml::symbol & id) const
+                OPENVRML_THROW1(openvrml::unsupported_interface) = 0;
+
         protected:
             abstract_node_type(const openvrml::node_metatype & metatype,
                                const std::string & id);
@@ -257,14 +270,17 @@ namespace openvrml {
 
         private:
             openvrml::node_interface_set interfaces_;
-            typedef std::map<std::string, field_ptr_ptr> field_value_map_t;
-            typedef std::map<std::string, event_listener_ptr_ptr>
+            typedef std::map<openvrml::symbol, field_ptr_ptr>
+            field_value_map_t;
+            typedef std::map<openvrml::symbol, event_listener_ptr_ptr>
             event_listener_map_t;
-            typedef std::map<std::string, event_emitter_ptr_ptr>
+            typedef std::map<openvrml::symbol, event_emitter_ptr_ptr>
             event_emitter_map_t;
             mutable field_value_map_t field_value_map;
             mutable event_listener_map_t event_listener_map;
             mutable event_emitter_map_t event_emitter_map;
+            mutable event_listener_map_t event_listener_alias_map;
+            mutable event_emitter_map_t event_emitter_alias_map;
 
         public:
             node_type_impl(const openvrml::node_metatype & metatype,
@@ -324,6 +340,19 @@ namespace openvrml {
             event_emitter(openvrml::node & node, const std::string & id) const
                 OPENVRML_THROW1(openvrml::unsupported_interface);
 
+            virtual const openvrml::field_value &
+            field_value(const openvrml::node & node,
+                        const openvrml::symbol & id) const
+                OPENVRML_THROW1(openvrml::unsupported_interface);
+            virtual openvrml::event_listener &
+            event_listener(openvrml::node & node,
+                           const openvrml::symbol & id) const
+                OPENVRML_THROW1(openvrml::unsupported_interface);
+            virtual openvrml::event_emitter &
+            event_emitter(openvrml::node & node,
+                          const openvrml::symbol & id) const
+                OPENVRML_THROW1(openvrml::unsupported_interface);
+
         private:
             virtual const openvrml::node_interface_set & do_interfaces() const
                 OPENVRML_NOTHROW;
@@ -335,7 +364,8 @@ namespace openvrml {
                                 std::bad_alloc);
 
             const openvrml::field_value &
-            do_field_value(const Node & node, const std::string & id) const
+            do_field_value(const Node & node,
+                           const openvrml::symbol & id) const
                 OPENVRML_THROW1(openvrml::unsupported_interface);
 
             void
@@ -346,10 +376,10 @@ namespace openvrml {
                                 std::bad_cast);
 
             openvrml::event_listener &
-            do_event_listener(Node & node, const std::string & id) const
+            do_event_listener(Node & node, const openvrml::symbol & id) const
                 OPENVRML_THROW1(openvrml::unsupported_interface);
             openvrml::event_emitter &
-            do_event_emitter(Node & node, const std::string & id) const
+            do_event_emitter(Node & node, const openvrml::symbol & id) const
                 OPENVRML_THROW1(openvrml::unsupported_interface);
         };
 
@@ -393,13 +423,16 @@ namespace openvrml {
                 const node_event_listener * listener_;
             };
 
+            mutable boost::atomic<openvrml::symbol> eventin_id_;
+
             virtual const std::string do_eventin_id() const OPENVRML_NOTHROW;
         };
 
         template <typename Node>
         event_listener_base<Node>::event_listener_base(openvrml::node & n)
             OPENVRML_NOTHROW:
-            node_event_listener(n)
+            node_event_listener(n),
+            eventin_id_(openvrml::symbol())
         {}
 
         template <typename Node>
@@ -410,16 +443,23 @@ namespace openvrml {
         const std::string
         event_listener_base<Node>::do_eventin_id() const OPENVRML_NOTHROW
         {
-            const node_type_t & node_type =
-                static_cast<const node_type_t &>(this->node().type());
-            const typename node_type_t::event_listener_map_t &
-                event_listener_map = node_type.event_listener_map;
-            const typename node_type_t::event_listener_map_t::const_iterator
-                pos = std::find_if(event_listener_map.begin(),
-                                   event_listener_map.end(),
-                                   event_listener_equal_to(*this));
-            assert(pos != event_listener_map.end());
-            return pos->first;
+            openvrml::symbol id =
+                this->eventin_id_.load(boost::memory_order_acquire);
+            if (id.empty()) {
+                const node_type_t & node_type =
+                    static_cast<const node_type_t &>(this->node().type());
+                const typename node_type_t::event_listener_map_t &
+                    event_listener_map = node_type.event_listener_map;
+                const typename node_type_t::event_listener_map_t::
+                    const_iterator pos =
+                    std::find_if(event_listener_map.begin(),
+                                 event_listener_map.end(),
+                                 event_listener_equal_to(*this));
+                assert(pos != event_listener_map.end());
+                id = pos->first;
+                this->eventin_id_.store(id, boost::memory_order_release);
+            }
+            return id.name();
         }
 
 
@@ -463,7 +503,10 @@ namespace openvrml {
                 const event_emitter_base<Node> * emitter_;
             };
 
+            mutable boost::atomic<openvrml::symbol> eventout_id_;
+
             virtual const std::string do_eventout_id() const OPENVRML_NOTHROW;
+            virtual openvrml::node * do_node() const OPENVRML_NOTHROW;
         };
 
         template <typename Node>
@@ -471,7 +514,8 @@ namespace openvrml {
         event_emitter_base(openvrml::node & n, const field_value & value)
             OPENVRML_NOTHROW:
             event_emitter(value),
-            node_(&n)
+            node_(&n),
+            eventout_id_(openvrml::symbol())
         {}
 
         template <typename Node>
@@ -489,16 +533,30 @@ namespace openvrml {
         const std::string
         event_emitter_base<Node>::do_eventout_id() const OPENVRML_NOTHROW
         {
-            const node_type_t & node_type =
-                static_cast<const node_type_t &>(this->node().type());
-            const typename node_type_t::event_emitter_map_t &
-                event_emitter_map = node_type.event_emitter_map;
-            const typename node_type_t::event_emitter_map_t::const_iterator
-                pos = std::find_if(event_emitter_map.begin(),
-                                   event_emitter_map.end(),
-                                   event_emitter_equal_to(*this));
-            assert(pos != event_emitter_map.end());
-            return pos->first;
+            openvrml::symbol id =
+                this->eventout_id_.load(boost::memory_order_acquire);
+            if (id.empty()) {
+                const node_type_t & node_type =
+                    static_cast<const node_type_t &>(this->node().type());
+                const typename node_type_t::event_emitter_map_t &
+                    event_emitter_map = node_type.event_emitter_map;
+                const typename node_type_t::event_emitter_map_t::
+                    const_iterator pos =
+                    std::find_if(event_emitter_map.begin(),
+                                 event_emitter_map.end(),
+                                 event_emitter_equal_to(*this));
+                assert(pos != event_emitter_map.end());
+                id = pos->first;
+                this->eventout_id_.store(id, boost::memory_order_release);
+            }
+            return id.name();
+        }
+
+        template <typename Node>
+        openvrml::node *
+        event_emitter_base<Node>::do_node() const OPENVRML_NOTHROW
+        {
+            return this->node_;
         }
 
 
@@ -594,6 +652,7 @@ namespace openvrml {
             private:
                 virtual std::auto_ptr<field_value> do_clone() const
                     OPENVRML_THROW1(std::bad_alloc);
+                virtual openvrml::node * do_node() const OPENVRML_NOTHROW;
             };
 
             exposedfield<sfnode> metadata;
@@ -616,6 +675,17 @@ namespace openvrml {
             virtual openvrml::event_emitter &
             do_event_emitter(const std::string & id)
                 OPENVRML_THROW1(unsupported_interface);
+
+            virtual const field_value & do_field(const symbol & id) const
+                OPENVRML_THROW1(unsupported_interface);
+
+            virtual openvrml::event_listener &
+            do_event_listener(const symbol & id)
+                OPENVRML_THROW1(unsupported_interface);
+
+            virtual openvrml::event_emitter &
+            do_event_emitter(const symbol & id)
+                OPENVRML_THROW1(unsupported_interface);
         };
 
         template <typename Derived>
@@ -681,6 +751,15 @@ namespace openvrml {
                 new exposedfield<FieldValue>(*this));
         }
 
+        template <typename Derived>
+        template <typename FieldValue>
+        openvrml::node *
+        abstract_node<Derived>::exposedfield<FieldValue>::do_node() const
+            OPENVRML_NOTHROW
+        {
+            return &this->event_emitter_base<Derived>::node();
+        }
+
         template <typename Derived>
         abstract_node<Derived>::
         abstract_node(const node_type & type,
@@ -742,6 +821,42 @@ namespace openvrml {
             return type.event_emitter(*this, id);
         }
 
+        template <typename Derived>
+        const field_value &
+        abstract_node<Derived>::do_field(const symbol & id) const
+            OPENVRML_THROW1(unsupported_interface)
+        {
+            using boost::polymorphic_downcast;
+            const abstract_node_type & type =
+                *polymorphic_downcast<const abstract_node_type *>(
+                    &this->type());
+            return type.field_value(*this, id);
+        }
+
+        template <typename Derived>
+        event_listener &
+        abstract_node<Derived>::do_event_listener(const symbol & id)
+            OPENVRML_THROW1(unsupported_interface)
+        {
+            using boost::polymorphic_downcast;
+            const abstract_node_type & type =
+                *polymorphic_downcast<const abstract_node_type *>(
+                    &this->type());
+            return type.event_listener(*this, id);
+        }
+
+        template <typename Derived>
+        event_emitter &
+        abstract_node<Derived>::do_event_emitter(const symbol & id)
+            OPENVRML_THROW1(unsupported_interface)
+        {
+            using boost::polymorphic_downcast;
+            const abstract_node_type & type =
+                *polymorphic_downcast<const abstract_node_type *>(
+                    &this->type());
+            return type.event_emitter(*this, id);
+        }
+
 
         template <typename Node>
         class node_field_ptr {
@@ -979,9 +1094,21 @@ namespace openvrml {
                                             + " node");
             }
             const typename event_listener_map_t::value_type
-                value(id, make_event_listener_ptr_ptr(event_listener));
+                value(openvrml::symbol(id),
+                      make_event_listener_ptr_ptr(event_listener));
             succeeded = this->event_listener_map.insert(value).second;
             assert(succeeded);
+            //
+            // An eventIn "set_foo" may also be addressed as "foo".
+            //
+            static const std::string eventin_prefix = "set_";
+            if (id.size() > eventin_prefix.size()
+                && id.compare(0, eventin_prefix.size(), eventin_prefix) == 0) {
+                const typename event_listener_map_t::value_type
+                    alias(openvrml::symbol(id.substr(eventin_prefix.size())),
+                          value.second);
+                this->event_listener_alias_map.insert(alias);
+            }
         }
 
         template <typename Node>
@@ -1004,9 +1131,25 @@ namespace openvrml {
                                             + " node");
             }
             const typename event_emitter_map_t::value_type
-                value(id, make_event_emitter_ptr_ptr(event_emitter));
+                value(openvrml::symbol(id),
+                      make_event_emitter_ptr_ptr(event_emitter));
             succeeded = this->event_emitter_map.insert(value).second;
             assert(succeeded);
+            //
+            // An eventOut "foo_changed" may also be addressed as "foo".
+            //
+            static const std::string eventout_suffix = "_changed";
+            if (id.size() > eventout_suffix.size()
+                && id.compare(id.size() - eventout_suffix.size(),
+                              eventout_suffix.size(),
+                              eventout_suffix) == 0) {
+                const typename event_emitter_map_t::value_type
+                    alias(openvrml::symbol(
+                              id.substr(0,
+                                        id.size() - eventout_suffix.size())),
+                          value.second);
+                this->event_emitter_alias_map.insert(alias);
+            }
         }
 
         template <typename Node>
@@ -1033,25 +1176,30 @@ namespace openvrml {
                                             "defined for " + this->id()
                                             + " node");
             }
+            const openvrml::symbol field_id(id);
             {
                 const typename event_listener_map_t::value_type
-                    value("set_" + id,
+                    value(openvrml::symbol("set_" + id),
                           make_event_listener_ptr_ptr(event_listener));
                 succeeded = this->event_listener_map.insert(value).second;
                 assert(succeeded);
+                this->event_listener_alias_map.insert(
+                    std::make_pair(field_id, value.second));
             }
             {
                 const typename field_value_map_t::value_type
-                    value(id, make_field_ptr_ptr(field));
+                    value(field_id, make_field_ptr_ptr(field));
                 succeeded = this->field_value_map.insert(value).second;
                 assert(succeeded);
             }
             {
                 const typename event_emitter_map_t::value_type
-                    value(id + "_changed",
+                    value(openvrml::symbol(id + "_changed"),
                           make_event_emitter_ptr_ptr(event_emitter));
                 succeeded = this->event_emitter_map.insert(value).second;
                 assert(succeeded);
+                this->event_emitter_alias_map.insert(
+                    std::make_pair(field_id, value.second));
             }
         }
 
@@ -1085,7 +1233,7 @@ namespace openvrml {
                                             + " node");
             }
             const typename field_value_map_t::value_type
-                value(id, make_field_ptr_ptr(field));
+                value(openvrml::symbol(id), make_field_ptr_ptr(field));
             succeeded = this->field_value_map.insert(value).second;
             assert(succeeded);
         }
@@ -1095,6 +1243,22 @@ namespace openvrml {
         node_type_impl<Node>::field_value(const openvrml::node & node,
                                                  const std::string & id) const
             OPENVRML_THROW1(openvrml::unsupported_interface)
+        {
+            const openvrml::symbol field_id = openvrml::symbol::find(id);
+            if (field_id.empty()) {
+                throw openvrml::unsupported_interface(
+                    node.type(),
+                    openvrml::node_interface::field_id,
+                    id);
+            }
+            return this->field_value(node, field_id);
+        }
+
+        template <typename Node>
+        const openvrml::field_value &
+        node_type_impl<Node>::field_value(const openvrml::node & node,
+                                          const openvrml::symbol & id) const
+            OPENVRML_THROW1(openvrml::unsupported_interface)
         {
             assert(dynamic_cast<const Node *>(&node));
             return this->do_field_value(dynamic_cast<const Node &>(node), id);
@@ -1118,7 +1282,7 @@ namespace openvrml {
         template <typename Node>
         const openvrml::field_value &
         node_type_impl<Node>::
-        do_field_value(const Node & node, const std::string & id) const
+        do_field_value(const Node & node, const openvrml::symbol & id) const
             OPENVRML_THROW1(openvrml::unsupported_interface)
         {
             using namespace openvrml;
@@ -1128,7 +1292,7 @@ namespace openvrml {
             if (itr == this->field_value_map.end()) {
                 throw unsupported_interface(node.node::type(),
                                             node_interface::field_id,
-                                            id);
+                                            id.name());
             }
             return itr->second->deref(node);
         }
@@ -1144,7 +1308,7 @@ namespace openvrml {
             using namespace openvrml;
 
             const typename field_value_map_t::const_iterator field =
-                this->field_value_map.find(id);
+                this->field_value_map.find(symbol::find(id));
             if (field == this->field_value_map.end()) {
                 throw unsupported_interface(*this,
                                             node_interface::field_id,
@@ -1159,6 +1323,23 @@ namespace openvrml {
         node_type_impl<Node>::
         event_listener(openvrml::node & node, const std::string & id) const
             OPENVRML_THROW1(openvrml::unsupported_interface)
+        {
+            const openvrml::symbol eventin_id = openvrml::symbol::find(id);
+            if (eventin_id.empty()) {
+                throw openvrml::unsupported_interface(
+                    node.type(),
+                    openvrml::node_interface::eventin_id,
+                    id);
+            }
+            return this->event_listener(node, eventin_id);
+        }
+
+        template <typename Node>
+        openvrml::event_listener &
+        node_type_impl<Node>::
+        event_listener(openvrml::node & node,
+                       const openvrml::symbol & id) const
+            OPENVRML_THROW1(openvrml::unsupported_interface)
         {
             assert(dynamic_cast<Node *>(&node));
             return this->do_event_listener(dynamic_cast<Node &>(node), id);
@@ -1167,22 +1348,20 @@ namespace openvrml {
         template <typename Node>
         openvrml::event_listener &
         node_type_impl<Node>::
-        do_event_listener(Node & node, const std::string & id) const
+        do_event_listener(Node & node, const openvrml::symbol & id) const
             OPENVRML_THROW1(openvrml::unsupported_interface)
         {
             using namespace openvrml;
 
-            const typename event_listener_map_t::const_iterator end =
-                this->event_listener_map.end();
             typename event_listener_map_t::const_iterator pos =
                 this->event_listener_map.find(id);
-            if (pos == end) {
-                pos = this->event_listener_map.find("set_" + id);
-            }
-            if (pos == end) {
-                throw unsupported_interface(node.node::type(),
-                                            node_interface::eventin_id,
-                                            id);
+            if (pos == this->event_listener_map.end()) {
+                pos = this->event_listener_alias_map.find(id);
+                if (pos == this->event_listener_alias_map.end()) {
+                    throw unsupported_interface(node.node::type(),
+                                                node_interface::eventin_id,
+                                                id.name());
+                }
             }
             return pos->second->deref(node);
         }
@@ -1192,6 +1371,23 @@ namespace openvrml {
         node_type_impl<Node>::
         event_emitter(openvrml::node & node, const std::string & id) const
             OPENVRML_THROW1(openvrml::unsupported_interface)
+        {
+            const openvrml::symbol eventout_id = openvrml::symbol::find(id);
+            if (eventout_id.empty()) {
+                throw openvrml::unsupported_interface(
+                    node.type(),
+                    openvrml::node_interface::eventout_id,
+                    id);
+            }
+            return this->event_emitter(node, eventout_id);
+        }
+
+        template <typename Node>
+        openvrml::event_emitter &
+        node_type_impl<Node>::
+        event_emitter(openvrml::node & node,
+                      const openvrml::symbol & id) const
+            OPENVRML_THROW1(openvrml::unsupported_interface)
         {
             assert(dynamic_cast<Node *>(&node));
             return this->do_event_emitter(dynamic_cast<Node &>(node), id);
@@ -1200,22 +1396,20 @@ namespace openvrml {
         template <typename Node>
         openvrml::event_emitter &
         node_type_impl<Node>::
-        do_event_emitter(Node & node, const std::string & id) const
+        do_event_emitter(Node & node, const openvrml::symbol & id) const
             OPENVRML_THROW1(openvrml::unsupported_interface)
         {
             using namespace openvrml;
 
-            const typename event_emitter_map_t::const_iterator end =
-                this->event_emitter_map.end();
             typename event_emitter_map_t::const_iterator pos =
                 this->event_emitter_map.find(id);
-            if (pos == end) {
-                pos = this->event_emitter_map.find(id + "_changed");
-            }
-            if (pos == end) {
-                throw unsupported_interface(node.node::type(),
-                                            node_interface::eventout_id,
-                                            id);
+            if (pos == this->event_emitter_map.end()) {
+                pos = this->event_emitter_alias_map.find(id);
+                if (pos == this->event_emitter_alias_map.end()) {
+                    throw unsupported_interface(node.node::type(),
+                                                node_interface::eventout_id,
+                                                id.name());
+                }
             }
             return pos->second->deref(node);
         }
@@ -1246,7 +1440,8 @@ namespace openvrml {
                  initial_value != initial_values.end();
                  ++initial_value) {
                 const typename field_value_map_t::const_iterator field =
-                    this->field_value_map.find(initial_value->first);
+                    this->field_value_map.find(
+                        symbol::find(initial_value->first));
                 if (field == this->field_value_map.end()) {
                     throw unsupported_interface(*this,
                                                 node_interface::field_id,
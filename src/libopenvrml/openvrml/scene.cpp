@@ -119,6 +119,41 @@
  * @brief Stream reader thread group.
  */
 
+/**
+ * @internal
+ *
+ * @var boost::shared_mutex openvrml::scene::bsphere_mutex_
+ *
+ * @brief Mutex protecting @c #bsphere_.
+ */
+
+/**
+ * @internal
+ *
+ * @var openvrml::bounding_sphere openvrml::scene::bsphere_
+ *
+ * @brief The cached bounding volume of the root <code>node</code>s.
+ */
+
+/**
+ * @internal
+ *
+ * @var boost::shared_mutex openvrml::scene::bsphere_dirty_mutex_
+ *
+ * @brief Mutex protecting @c #bsphere_dirty_.
+ *
+ * This is separate from @c #bsphere_mutex_ so that a bounding volume change
+ * during the recalculation in @c #bounding_volume can still be recorded.
+ */
+
+/**
+ * @internal
+ *
+ * @var bool openvrml::scene::bsphere_dirty_
+ *
+ * @brief Whether @c #bsphere_ needs to be recalculated.
+ */
+
 /**
  * @brief Construct.
  *
@@ -128,7 +163,8 @@
 openvrml::scene::scene(openvrml::browser & browser, scene * parent)
     OPENVRML_NOTHROW:
     browser_(&browser),
-    parent_(parent)
+    parent_(parent),
+    bsphere_dirty_(true)
 {}
 
 /**
@@ -197,6 +233,7 @@ void openvrml::scene::load(resource_istream & in)
         local::parse_vrml(in, in.url(), in.type(),
                           *this, this->nodes_, this->meta_);
     }
+    this->bounding_volume_dirty();
 }
 
 /**
@@ -222,6 +259,7 @@ void openvrml::scene::initialize(const double timestamp)
             child->relocate();
         }
     }
+    this->bounding_volume_dirty();
 }
 
 /**
@@ -340,43 +378,74 @@ void openvrml::scene::nodes(const std::vector<boost::intrusive_ptr<node> > & n)
     } check_uninitialized;
     check_uninitialized.traverse(n);
 
-    unique_lock<shared_mutex> lock(this->nodes_mutex_);
     const double now = browser::current_time();
     this->shutdown(now);
-    this->nodes_ = n;
+    {
+        unique_lock<shared_mutex> lock(this->nodes_mutex_);
+        this->nodes_ = n;
+    }
+    this->bounding_volume_dirty();
 }
 
-const openvrml::bounding_volume& 
+/**
+ * @brief Get the bounding volume of the root <code>node</code>s.
+ *
+ * The result is cached; it is recalculated only after the bounding volume
+ * of a root @c node (or of one of its descendants) changes, or the root
+ * <code>node</code>s are replaced.  Recalculation uses the root
+ * <code>node</code>s' own cached bounding volumes.
+ *
+ * @return the bounding volume of the root <code>node</code>s.
+ */
+const openvrml::bounding_volume &
 openvrml::scene::bounding_volume() const
 {
+    using boost::shared_lock;
     using boost::unique_lock;
     using boost::shared_mutex;
 
-    typedef std::vector<boost::intrusive_ptr<openvrml::node> > nodes_vec_t;
-    typedef nodes_vec_t::const_iterator nodes_vec_citer_t;
+    scene & self = const_cast<scene &>(*this);
 
     unique_lock<shared_mutex> lock(this->bsphere_mutex_);
-    const_cast<scene*>(this)->bsphere_ = openvrml::bounding_sphere();
-
-    nodes_vec_t nodes = this->nodes();
-    for( nodes_vec_citer_t iter = nodes.begin(); iter != nodes.end(); ++iter )
     {
-        const openvrml::bounded_volume_node* node = 
-            dynamic_cast<const openvrml::bounded_volume_node*>(iter->get());
-        if( node != NULL ) {
-            const openvrml::bounding_sphere *bs = 
-                dynamic_cast<const openvrml::bounding_sphere*>(
-                    &(node->bounding_volume())
-                );
-            if( bs != NULL ) {
-                const_cast<scene*>(this)->bsphere_.extend( *bs );
-            }
-        }
+        unique_lock<shared_mutex> dirty_lock(this->bsphere_dirty_mutex_);
+        if (!this->bsphere_dirty_) { return this->bsphere_; }
+        self.bsphere_dirty_ = false;
+    }
+
+    self.bsphere_ = openvrml::bounding_sphere();
+
+    shared_lock<shared_mutex> nodes_lock(this->nodes_mutex_);
+    for (std::vector<boost::intrusive_ptr<node> >::const_iterator n =
+             this->nodes_.begin();
+         n != this->nodes_.end();
+         ++n) {
+        const bounded_volume_node * const bvn =
+            node_cast<bounded_volume_node *>(n->get());
+        if (bvn) { self.bsphere_.extend(bvn->bounding_volume()); }
     }
 
     return this->bsphere_;
 }
 
+/**
+ * @internal
+ *
+ * @brief Note that the bounding volume of a root @c node has changed.
+ *
+ * @exception boost::thread_resource_error  if a mutex cannot be locked.
+ *
+ * @post @c #bounding_volume will recalculate the bounding volume.
+ */
+void openvrml::scene::bounding_volume_dirty()
+    OPENVRML_THROW1(boost::thread_resource_error)
+{
+    using boost::unique_lock;
+    using boost::shared_mutex;
+    unique_lock<shared_mutex> lock(this->bsphere_dirty_mutex_);
+    this->bsphere_dirty_ = true;
+}
+
 /**
  * @brief Get the root @c scope.
  *
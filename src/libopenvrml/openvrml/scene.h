@@ -33,6 +33,8 @@ namespace openvrml {
     class stream_listener;
 
     class OPENVRML_API scene : boost::noncopyable {
+        friend class node;
+
         struct vrml_from_url_creator;
 
         openvrml::browser * const browser_;
@@ -51,7 +53,10 @@ namespace openvrml {
 
         mutable boost::shared_mutex bsphere_mutex_;
         openvrml::bounding_sphere bsphere_;
-        
+
+        mutable boost::shared_mutex bsphere_dirty_mutex_;
+        bool bsphere_dirty_;
+
     public:
         explicit scene(openvrml::browser & browser, scene * parent = 0)
             OPENVRML_NOTHROW;
@@ -91,6 +96,9 @@ namespace openvrml {
         void shutdown(double timestamp) OPENVRML_NOTHROW;
 
     private:
+        void bounding_volume_dirty()
+            OPENVRML_THROW1(boost::thread_resource_error);
+
         virtual void scene_loaded();
     };
 }
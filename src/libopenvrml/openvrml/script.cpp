@@ -1443,6 +1443,7 @@ public:
 
 private:
     virtual const std::string do_eventout_id() const OPENVRML_NOTHROW;
+    virtual openvrml::node * do_node() const OPENVRML_NOTHROW;
 };
 
 /**
@@ -1492,6 +1493,19 @@ openvrml::script_node::script_event_emitter<FieldValue>::do_eventout_id() const
     return pos->first;
 }
 
+/**
+ * @brief The @c script_node.
+ *
+ * @return the @c script_node.
+ */
+template <typename FieldValue>
+openvrml::node *
+openvrml::script_node::script_event_emitter<FieldValue>::do_node() const
+    OPENVRML_NOTHROW
+{
+    return this->node_;
+}
+
 /**
  * @internal
  *
@@ -1622,15 +1636,23 @@ do_process_event(const mfstring & value, const double timestamp)
  * @brief @c url_changed event emitter.
  */
 
+/**
+ * @var openvrml::script_node * openvrml::script_node::url_changed_emitter::node_
+ *
+ * @brief The @c script_node.
+ */
+
 /**
  * @brief Construct.
  *
+ * @param[in] node  the @c script_node.
  * @param[in] value the associated field value.
  */
 openvrml::script_node::url_changed_emitter::
-url_changed_emitter(const mfstring & value) OPENVRML_NOTHROW:
+url_changed_emitter(script_node & node, const mfstring & value) OPENVRML_NOTHROW:
     openvrml::event_emitter(value),
-    openvrml::mfstring_emitter(value)
+    openvrml::mfstring_emitter(value),
+    node_(&node)
 {}
 
 /**
@@ -1650,6 +1672,17 @@ openvrml::script_node::url_changed_emitter::do_eventout_id() const OPENVRML_NOTH
     return "url_changed";
 }
 
+/**
+ * @brief The @c script_node.
+ *
+ * @return the @c script_node.
+ */
+openvrml::node *
+openvrml::script_node::url_changed_emitter::do_node() const OPENVRML_NOTHROW
+{
+    return this->node_;
+}
+
 /**
  * @internal
  *
@@ -1718,15 +1751,23 @@ do_process_event(const sfnode & value, const double timestamp)
  * @brief @c metadata_changed event emitter.
  */
 
+/**
+ * @var openvrml::script_node * openvrml::script_node::metadata_changed_emitter::node_
+ *
+ * @brief The @c script_node.
+ */
+
 /**
  * @brief Construct.
  *
+ * @param[in] node  the @c script_node.
  * @param[in] value the associated field value.
  */
 openvrml::script_node::metadata_changed_emitter::
-metadata_changed_emitter(const sfnode & value) OPENVRML_NOTHROW:
+metadata_changed_emitter(script_node & node, const sfnode & value) OPENVRML_NOTHROW:
     openvrml::event_emitter(value),
-    openvrml::sfnode_emitter(value)
+    openvrml::sfnode_emitter(value),
+    node_(&node)
 {}
 
 /**
@@ -1748,6 +1789,17 @@ openvrml::script_node::metadata_changed_emitter::do_eventout_id() const
     return "metadata_changed";
 }
 
+/**
+ * @brief The @c script_node.
+ *
+ * @return the @c script_node.
+ */
+openvrml::node *
+openvrml::script_node::metadata_changed_emitter::do_node() const OPENVRML_NOTHROW
+{
+    return this->node_;
+}
+
 /**
  * @internal
  *
@@ -1939,11 +1991,11 @@ script_node(script_node_metatype & class_,
     child_node(this->type_, scope),
     type_(class_),
     set_metadata_listener_(*this),
-    metadata_changed_emitter_(this->metadata_),
+    metadata_changed_emitter_(*this, this->metadata_),
     direct_output(false),
     must_evaluate(false),
     set_url_listener(*this),
-    url_changed_emitter_(this->url_),
+    url_changed_emitter_(*this, this->url_),
     script_(0),
     events_received(0)
 {
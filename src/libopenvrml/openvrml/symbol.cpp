@@ -0,0 +1,278 @@
+// -*- mode: c++; indent-tabs-mode: nil; c-basic-offset: 4; fill-column: 78 -*-
+//
+// OpenVRML
+//
+// Copyright 2026  Braden McDaniel
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at your
+// option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, see <http://www.gnu.org/licenses/>.
+//
+
+# ifdef HAVE_CONFIG_H
+#   include <config.h>
+# endif
+
+# include "symbol.h"
+# include <boost/noncopyable.hpp>
+# include <boost/thread/shared_mutex.hpp>
+# include <boost/thread/locks.hpp>
+# include <boost/unordered_map.hpp>
+# include <ostream>
+
+/**
+ * @file openvrml/symbol.h
+ *
+ * @brief Definition of @c openvrml::symbol.
+ */
+
+namespace {
+
+    //
+    // Entries are never removed; a symbol holds a pointer to its entry, so
+    // the table must use node-based storage (which boost::unordered_map
+    // does) and must outlive every symbol.
+    //
+    class OPENVRML_LOCAL symbol_table : boost::noncopyable {
+    public:
+        typedef boost::unordered_map<std::string, openvrml::symbol::id_type>
+            map_t;
+
+    private:
+        mutable boost::shared_mutex mutex_;
+        map_t map_;
+
+    public:
+        static symbol_table & instance() OPENVRML_NOTHROW;
+
+        const map_t::value_type * find(const std::string & name) const
+            OPENVRML_NOTHROW;
+        const map_t::value_type * intern(const std::string & name)
+            OPENVRML_THROW1(std::bad_alloc);
+    };
+
+    symbol_table & symbol_table::instance() OPENVRML_NOTHROW
+    {
+        //
+        // Intentionally leaked so that symbols remain valid during static
+        // destruction.
+        //
+        static symbol_table * const table = new symbol_table;
+        return *table;
+    }
+
+    const symbol_table::map_t::value_type *
+    symbol_table::find(const std::string & name) const OPENVRML_NOTHROW
+    {
+        boost::shared_lock<boost::shared_mutex> lock(this->mutex_);
+        const map_t::const_iterator pos = this->map_.find(name);
+        return (pos != this->map_.end()) ? &*pos : 0;
+    }
+
+    const symbol_table::map_t::value_type *
+    symbol_table::intern(const std::string & name)
+        OPENVRML_THROW1(std::bad_alloc)
+    {
+        const map_t::value_type * result = this->find(name);
+        if (result) { return result; }
+
+        boost::unique_lock<boost::shared_mutex> lock(this->mutex_);
+        //
+        // Identifier 0 is reserved for the empty symbol.
+        //
+        const map_t::value_type value(name, this->map_.size() + 1);
+        return &*this->map_.insert(value).first;
+    }
+}
+
+/**
+ * @class openvrml::symbol openvrml/symbol.h
+ *
+ * @brief An interned identifier.
+ *
+ * Interning maps each distinct string to a single process-wide entry, so a
+ * @c symbol can be copied, compared and hashed in constant time.  Each
+ * nonempty @c symbol has a small integer @link symbol::id id@endlink,
+ * assigned in order of first interning; the default-constructed (empty)
+ * @c symbol has the identifier 0.
+ *
+ * @c node_type_impl keys its interface tables by @c symbol; the
+ * <code>symbol</code>-based overloads of @c node::field,
+ * @c node::event_listener, @c node::event_emitter, @c add_route and
+ * @c delete_route avoid string comparisons altogether.
+ *
+ * Interned strings are never released.  Interning is thread-safe; the
+ * accessors do not lock.
+ */
+
+/**
+ * @typedef openvrml::symbol::id_type
+ *
+ * @brief Integral @c symbol identifier type.
+ */
+
+/**
+ * @internal
+ *
+ * @typedef openvrml::symbol::entry
+ *
+ * @brief An entry in the symbol table.
+ */
+
+/**
+ * @internal
+ *
+ * @var const openvrml::symbol::entry * openvrml::symbol::entry_
+ *
+ * @brief The symbol table entry, or 0 for the empty @c symbol.
+ */
+
+/**
+ * @internal
+ *
+ * @fn openvrml::symbol::symbol(const entry * e)
+ *
+ * @brief Construct from a symbol table entry.
+ *
+ * @param[in] e a symbol table entry.
+ */
+
+/**
+ * @brief Look up an interned @c symbol without interning @p name.
+ *
+ * @param[in] name  a string.
+ *
+ * @return the @c symbol for @p name if it has been interned; otherwise, the
+ *         empty @c symbol.
+ */
+const openvrml::symbol openvrml::symbol::find(const std::string & name)
+    OPENVRML_NOTHROW
+{
+    if (name.empty()) { return symbol(); }
+    return symbol(symbol_table::instance().find(name));
+}
+
+/**
+ * @fn openvrml::symbol::symbol()
+ *
+ * @brief Construct the empty @c symbol.
+ */
+
+/**
+ * @brief Construct, interning @p name.
+ *
+ * @param[in] name  a string.
+ *
+ * @exception std::bad_alloc    if memory allocation fails.
+ */
+openvrml::symbol::symbol(const std::string & name)
+    OPENVRML_THROW1(std::bad_alloc):
+    entry_(name.empty() ? 0 : symbol_table::instance().intern(name))
+{}
+
+/**
+ * @fn openvrml::symbol::id_type openvrml::symbol::id() const
+ *
+ * @brief The identifier.
+ *
+ * @return the identifier.
+ */
+
+/**
+ * @brief The interned string.
+ *
+ * @return the interned string.
+ */
+const std::string & openvrml::symbol::name() const OPENVRML_NOTHROW
+{
+    static const std::string empty;
+    return this->entry_ ? this->entry_->first : empty;
+}
+
+/**
+ * @fn bool openvrml::symbol::empty() const
+ *
+ * @brief Whether this is the empty @c symbol.
+ *
+ * @return @c true if this is the empty @c symbol; @c false otherwise.
+ */
+
+/**
+ * @fn bool openvrml::operator==(const symbol & lhs, const symbol & rhs)
+ *
+ * @relatesalso openvrml::symbol
+ *
+ * @brief Compare for equality.
+ *
+ * @param[in] lhs   left-hand operand.
+ * @param[in] rhs   right-hand operand.
+ *
+ * @return @c true if @p lhs and @p rhs are the same @c symbol; @c false
+ *         otherwise.
+ */
+
+/**
+ * @fn bool openvrml::operator!=(const symbol & lhs, const symbol & rhs)
+ *
+ * @relatesalso openvrml::symbol
+ *
+ * @brief Compare for inequality.
+ *
+ * @param[in] lhs   left-hand operand.
+ * @param[in] rhs   right-hand operand.
+ *
+ * @return @c true if @p lhs and @p rhs are different @c symbol%s; @c false
+ *         otherwise.
+ */
+
+/**
+ * @fn bool openvrml::operator<(const symbol & lhs, const symbol & rhs)
+ *
+ * @relatesalso openvrml::symbol
+ *
+ * @brief Order by identifier.
+ *
+ * This ordering reflects the order in which the symbols were interned; it
+ * is not lexicographical.
+ *
+ * @param[in] lhs   left-hand operand.
+ * @param[in] rhs   right-hand operand.
+ *
+ * @return @c true if @p lhs was interned before @p rhs; @c false otherwise.
+ */
+
+/**
+ * @fn std::size_t openvrml::hash_value(const symbol & s)
+ *
+ * @relatesalso openvrml::symbol
+ *
+ * @brief Hash function for use with Boost.Unordered.
+ *
+ * @param[in] s a @c symbol.
+ *
+ * @return a hash value for @p s.
+ */
+
+/**
+ * @relatesalso openvrml::symbol
+ *
+ * @brief Stream output.
+ *
+ * @param[in,out] out   an output stream.
+ * @param[in]     s     a @c symbol.
+ *
+ * @return @p out.
+ */
+std::ostream & openvrml::operator<<(std::ostream & out, const symbol & s)
+{
+    return out << s.name();
+}
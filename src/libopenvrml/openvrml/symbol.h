@@ -0,0 +1,100 @@
+// -*- mode: c++; indent-tabs-mode: nil; c-basic-offset: 4; fill-column: 78 -*-
+//
+// OpenVRML
+//
+// Copyright 2026  Braden McDaniel
+//
+// This library is free software; you can redistribute it and/or modify it
+// under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation; either version 3 of the License, or (at your
+// option) any later version.
+//
+// This library is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+// License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library; if not, see <http://www.gnu.org/licenses/>.
+//
+
+# ifndef OPENVRML_SYMBOL_H
+#   define OPENVRML_SYMBOL_H
+
+#   include <openvrml-common.h>
+#   include <cstddef>
+#   include <iosfwd>
+#   include <string>
+#   include <utility>
+
+namespace openvrml {
+
+    class OPENVRML_API symbol {
+    public:
+        typedef std::size_t id_type;
+
+    private:
+        typedef std::pair<const std::string, id_type> entry;
+
+        const entry * entry_;
+
+        explicit symbol(const entry * e) OPENVRML_NOTHROW;
+
+    public:
+        static const symbol find(const std::string & name) OPENVRML_NOTHROW;
+
+        symbol() OPENVRML_NOTHROW;
+        explicit symbol(const std::string & name)
+            OPENVRML_THROW1(std::bad_alloc);
+
+        id_type id() const OPENVRML_NOTHROW;
+        const std::string & name() const OPENVRML_NOTHROW;
+        bool empty() const OPENVRML_NOTHROW;
+    };
+
+    inline symbol::symbol() OPENVRML_NOTHROW:
+        entry_(0)
+    {}
+
+    inline symbol::symbol(const entry * const e) OPENVRML_NOTHROW:
+        entry_(e)
+    {}
+
+    inline symbol::id_type symbol::id() const OPENVRML_NOTHROW
+    {
+        return this->entry_ ? this->entry_->second : 0;
+    }
+
+    inline bool symbol::empty() const OPENVRML_NOTHROW
+    {
+        return !this->entry_;
+    }
+
+    inline bool operator==(const symbol & lhs, const symbol & rhs)
+        OPENVRML_NOTHROW
+    {
+        return lhs.id() == rhs.id();
+    }
+
+    inline bool operator!=(const symbol & lhs, const symbol & rhs)
+        OPENVRML_NOTHROW
+    {
+        return !(lhs == rhs);
+    }
+
+    inline bool operator<(const symbol & lhs, const symbol & rhs)
+        OPENVRML_NOTHROW
+    {
+        return lhs.id() < rhs.id();
+    }
+
+    inline std::size_t hash_value(const symbol & s) OPENVRML_NOTHROW
+    {
+        return s.id();
+    }
+
+    OPENVRML_API std::ostream & operator<<(std::ostream & out,
+                                           const symbol & s);
+}
+
+# endif
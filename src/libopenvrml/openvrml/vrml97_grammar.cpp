@@ -24,6 +24,75 @@
  * @brief VRML97 Spirit grammar and associated parsers.
  */
 
+/**
+ * @class openvrml::buffer_position_iterator openvrml/vrml97_grammar.h
+ *
+ * @brief An iterator over a contiguous character buffer that can report its
+ *        file position.
+ *
+ * @c buffer_position_iterator can be used in place of
+ * @c boost::spirit::classic::position_iterator when the whole input is in
+ * memory.  @c position_iterator updates its line and column on every
+ * increment, and every copy made for backtracking copies the file name.
+ * @c buffer_position_iterator does neither; @c #get_position scans from the
+ * start of the buffer, so it should be called only to report a diagnostic.
+ *
+ * The buffer and the file name must outlive the iterator.
+ */
+
+/**
+ * @var const int openvrml::buffer_position_iterator::tab_chars
+ *
+ * @brief Number of columns to a tab stop.
+ *
+ * This matches the default for @c position_iterator.
+ */
+
+/**
+ * @var const char * openvrml::buffer_position_iterator::begin_
+ *
+ * @brief The beginning of the buffer.
+ */
+
+/**
+ * @var const char * openvrml::buffer_position_iterator::pos_
+ *
+ * @brief The current position.
+ */
+
+/**
+ * @var const std::string * openvrml::buffer_position_iterator::file_
+ *
+ * @brief The file name.
+ */
+
+/**
+ * @fn openvrml::buffer_position_iterator::buffer_position_iterator()
+ *
+ * @brief Construct a singular iterator.
+ */
+
+/**
+ * @fn openvrml::buffer_position_iterator::buffer_position_iterator(const char * begin, const char * pos, const std::string & file)
+ *
+ * @brief Construct.
+ *
+ * @param[in] begin the beginning of the buffer.
+ * @param[in] pos   the position in the buffer.
+ * @param[in] file  the file name.
+ */
+
+/**
+ * @fn const boost::spirit::classic::file_position openvrml::buffer_position_iterator::get_position() const
+ *
+ * @brief The file position.
+ *
+ * Line and column numbers start at 1.  &ldquo;\\r\\n&rdquo; counts as a
+ * single line break.
+ *
+ * @return the file position.
+ */
+
 /**
  * @struct openvrml::vrml97_space_parser openvrml/vrml97_grammar.h
  *
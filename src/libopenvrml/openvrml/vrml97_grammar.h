@@ -26,11 +26,117 @@
 #   include <boost/spirit/include/classic_actor.hpp>
 #   include <boost/spirit/include/classic_dynamic.hpp>
 #   include <boost/spirit/include/phoenix1.hpp>
+#   include <boost/iterator/iterator_facade.hpp>
+#   include <boost/ref.hpp>
 #   include <boost/test/floating_point_comparison.hpp>
+#   include <boost/thread/thread.hpp>
+#   include <algorithm>
+#   include <cstring>
 #   include <stack>
 
 namespace openvrml {
 
+    class buffer_position_iterator :
+        public boost::iterator_facade<buffer_position_iterator,
+                                      const char,
+                                      boost::random_access_traversal_tag> {
+        friend class boost::iterator_core_access;
+
+        const char * begin_;
+        const char * pos_;
+        const std::string * file_;
+
+    public:
+        static const int tab_chars = 4;
+
+        buffer_position_iterator();
+        buffer_position_iterator(const char * begin, const char * pos,
+                                 const std::string & file);
+
+        const boost::spirit::classic::file_position get_position() const;
+
+    private:
+        const char & dereference() const;
+        bool equal(const buffer_position_iterator & other) const;
+        void increment();
+        void decrement();
+        void advance(std::ptrdiff_t n);
+        std::ptrdiff_t
+            distance_to(const buffer_position_iterator & other) const;
+    };
+
+    inline buffer_position_iterator::buffer_position_iterator():
+        begin_(0),
+        pos_(0),
+        file_(0)
+    {}
+
+    inline
+    buffer_position_iterator::
+    buffer_position_iterator(const char * const begin,
+                             const char * const pos,
+                             const std::string & file):
+        begin_(begin),
+        pos_(pos),
+        file_(&file)
+    {}
+
+    inline const boost::spirit::classic::file_position
+    buffer_position_iterator::get_position() const
+    {
+        boost::spirit::classic::file_position result;
+        if (this->file_) { result.file = *this->file_; }
+        for (const char * c = this->begin_; c != this->pos_; ++c) {
+            if (*c == '\r' || *c == '\n') {
+                if (*c == '\r' && c + 1 != this->pos_ && c[1] == '\n') {
+                    ++c;
+                }
+                ++result.line;
+                result.column = 1;
+            } else if (*c == '\t') {
+                result.column += tab_chars - (result.column - 1) % tab_chars;
+            } else {
+                ++result.column;
+            }
+        }
+        return result;
+    }
+
+    inline const char & buffer_position_iterator::dereference() const
+    {
+        return *this->pos_;
+    }
+
+    inline bool
+    buffer_position_iterator::equal(const buffer_position_iterator & other)
+        const
+    {
+        return this->pos_ == other.pos_;
+    }
+
+    inline void buffer_position_iterator::increment()
+    {
+        ++this->pos_;
+    }
+
+    inline void buffer_position_iterator::decrement()
+    {
+        --this->pos_;
+    }
+
+    inline void buffer_position_iterator::advance(const std::ptrdiff_t n)
+    {
+        this->pos_ += n;
+    }
+
+    inline std::ptrdiff_t
+    buffer_position_iterator::
+    distance_to(const buffer_position_iterator & other) const
+    {
+        return other.pos_ - this->pos_;
+    }
+
+
     struct vrml97_space_parser :
         boost::spirit::classic::char_parser<vrml97_space_parser> {
 
@@ -282,6 +388,415 @@ namespace openvrml {
             boost::spirit::classic::real_parser<float, boost::spirit::classic::real_parser_policies<float> >();
 
 
+    //
+    // Scanning for the bulk of the numeric MF payloads.  mftype_parser
+    // runs these directly over the input, bypassing the rule machinery and
+    // the skip grammar; they yield exactly what float_p, real_p and int32_p
+    // do.  Anything they do not handle (overlong digit strings, for
+    // instance) is left for the Spirit parsers, which also report errors.
+    //
+
+    template <typename Iterator>
+    void bulk_skip(Iterator & first, const Iterator & last)
+    {
+        //
+        // vrml97_skip_grammar: vrml97_space_p | comment_p("#").
+        //
+        while (first != last) {
+            if (vrml97_space_p.test(*first)) {
+                ++first;
+            } else if (*first == '#') {
+                do { ++first; } while (first != last
+                                       && *first != '\n'
+                                       && *first != '\r');
+                if (first != last && *first++ == '\r'
+                    && first != last && *first == '\n') {
+                    ++first;
+                }
+            } else {
+                break;
+            }
+        }
+    }
+
+    //
+    // Digit strings longer than these are left to the Spirit parsers, which
+    // check for overflow.
+    //
+    const int bulk_max_real_digits = 30;
+    const int bulk_max_int32_digits = 9;
+
+    template <typename T, typename Iterator>
+    bool bulk_scan_real(Iterator & first, const Iterator & last, T & result)
+    {
+        //
+        // This follows boost::spirit::classic::real_parser step for step,
+        // so that the rounding is the same.
+        //
+        using namespace std; // for pow, as in real_parser
+
+        Iterator pos = first;
+
+        bool neg = false;
+        if (pos != last && (*pos == '+' || *pos == '-')) {
+            neg = (*pos == '-');
+            ++pos;
+        }
+
+        T n = T(0);
+        int digits = 0;
+        for (; pos != last && *pos >= '0' && *pos <= '9'; ++pos) {
+            if (++digits > bulk_max_real_digits) { return false; }
+            n *= 10;
+            n += T(*pos - '0');
+        }
+        const bool got_a_number = digits > 0;
+        if (neg) { n = -n; }
+
+        if (pos != last && *pos == '.') {
+            ++pos;
+            T frac = T(0);
+            digits = 0;
+            for (; pos != last && *pos >= '0' && *pos <= '9'; ++pos) {
+                if (++digits > bulk_max_real_digits) { return false; }
+                frac *= 10;
+                frac += T(*pos - '0');
+            }
+            if (digits > 0) {
+                frac = frac * pow(T(10), T(-digits));
+                if (neg) { n -= frac; } else { n += frac; }
+            } else if (!got_a_number) {
+                return false;
+            }
+        } else if (!got_a_number) {
+            return false;
+        }
+
+        if (pos != last && (*pos == 'e' || *pos == 'E')) {
+            ++pos;
+            bool exp_neg = false;
+            if (pos != last && (*pos == '+' || *pos == '-')) {
+                exp_neg = (*pos == '-');
+                ++pos;
+            }
+            T exp = T(0);
+            digits = 0;
+            for (; pos != last && *pos >= '0' && *pos <= '9'; ++pos) {
+                if (++digits > bulk_max_real_digits) { return false; }
+                exp *= 10;
+                if (exp_neg) {
+                    exp -= T(*pos - '0');
+                } else {
+                    exp += T(*pos - '0');
+                }
+            }
+            if (digits == 0) { return false; }
+            n *= pow(T(10), exp);
+        }
+
+        first = pos;
+        result = n;
+        return true;
+    }
+
+    template <typename Iterator>
+    bool bulk_scan_int32(Iterator & first, const Iterator & last,
+                         openvrml::int32 & result)
+    {
+        //
+        // As int32_parser: "0x" followed by hex digits, or a decimal
+        // integer.
+        //
+        if (first != last && *first == '0') {
+            Iterator pos = first;
+            ++pos;
+            if (pos != last && (*pos == 'x' || *pos == 'X')) {
+                ++pos;
+                unsigned int n = 0;
+                int digits = 0;
+                for (; pos != last; ++pos) {
+                    const char c = *pos;
+                    unsigned int d;
+                    if (c >= '0' && c <= '9') {
+                        d = c - '0';
+                    } else if (c >= 'a' && c <= 'f') {
+                        d = c - 'a' + 10;
+                    } else if (c >= 'A' && c <= 'F') {
+                        d = c - 'A' + 10;
+                    } else {
+                        break;
+                    }
+                    if (++digits > 8) { return false; }
+                    n = n * 16 + d;
+                }
+                if (digits > 0) {
+                    first = pos;
+                    result = n;
+                    return true;
+                }
+            }
+        }
+
+        Iterator pos = first;
+        bool neg = false;
+        if (pos != last && (*pos == '+' || *pos == '-')) {
+            neg = (*pos == '-');
+            ++pos;
+        }
+        openvrml::int32 n = 0;
+        int digits = 0;
+        for (; pos != last && *pos >= '0' && *pos <= '9'; ++pos) {
+            if (++digits > bulk_max_int32_digits) { return false; }
+            n = n * 10 + (*pos - '0');
+        }
+        if (digits == 0) { return false; }
+
+        first = pos;
+        result = neg ? -n : n;
+        return true;
+    }
+
+    template <typename T, std::size_t N, typename Iterator>
+    bool bulk_scan_reals(Iterator & first, const Iterator & last, T (&v)[N])
+    {
+        for (std::size_t i = 0; i < N; ++i) {
+            if (i > 0) { bulk_skip(first, last); }
+            if (!bulk_scan_real(first, last, v[i])) { return false; }
+        }
+        return true;
+    }
+
+    template <std::size_t N, typename Iterator>
+    bool bulk_scan_intensities(Iterator & first, const Iterator & last,
+                               float (&v)[N])
+    {
+        if (!bulk_scan_reals(first, last, v)) { return false; }
+        for (std::size_t i = 0; i < N; ++i) {
+            if (!(v[i] >= 0.0 && v[i] <= 1.0)) { return false; }
+        }
+        return true;
+    }
+
+    //
+    // bulk_element_scanner<ElementParser>::scan reads one element, with no
+    // leading space, the way ElementParser would.  It returns false (with
+    // first in an unspecified position) where ElementParser should take
+    // over.
+    //
+    template <typename ElementParser>
+    struct bulk_element_scanner {
+        static const bool enabled = false;
+
+        template <typename Iterator, typename T>
+        static bool scan(Iterator &, const Iterator &, T &)
+        {
+            return false;
+        }
+    };
+
+    template <typename T>
+    struct bulk_element_scanner<
+        boost::spirit::classic::real_parser<
+            T, boost::spirit::classic::real_parser_policies<T> > > {
+        static const bool enabled = true;
+
+        template <typename Iterator>
+        static bool scan(Iterator & first, const Iterator & last,
+                         T & value)
+        {
+            return bulk_scan_real(first, last, value);
+        }
+    };
+
+    struct bulk_int32_parser {
+        typedef openvrml::int32 result_t;
+
+        template <typename ScannerT>
+        std::ptrdiff_t operator()(const ScannerT & scan,
+                                  result_t & result) const
+        {
+            typename ScannerT::iterator_t pos = scan.first;
+            bulk_skip(pos, scan.last);
+            if (!bulk_scan_int32(pos, scan.last, result)) { return -1; }
+            const std::ptrdiff_t length = std::distance(scan.first, pos);
+            scan.first = pos;
+            return length;
+        }
+    };
+
+    const boost::spirit::classic::functor_parser<bulk_int32_parser>
+        bulk_int32_p;
+
+    //
+    // Scan as many elements as possible, the way a run of ElementParser
+    // would.  Returns the position following the last element.
+    //
+    template <typename ElementScanner, typename Iterator, typename Value>
+    const Iterator bulk_scan_run(const Iterator & first,
+                                 const Iterator & last,
+                                 std::vector<Value> & values)
+    {
+        Value value;
+        Iterator pos = first;
+        for (;;) {
+            Iterator element = pos;
+            bulk_skip(element, last);
+            if (!ElementScanner::scan(element, last, value)) { break; }
+            values.push_back(value);
+            pos = element;
+        }
+        return pos;
+    }
+
+    //
+    // A large run in a contiguous buffer is split into pieces just after
+    // line feeds and the pieces are scanned on separate threads.  Neither
+    // a number nor a comment can continue past a line break; so as long as
+    // each piece but the last is consumed entirely, every piece starts at
+    // an element boundary and the pieces yield exactly the elements a
+    // single bulk_scan_run would.  If any piece falls short (say, because
+    // an element spans lines), the pieces are discarded.
+    //
+    const std::ptrdiff_t bulk_min_piece_size = 256 * 1024;
+
+    template <typename ElementScanner, typename Value>
+    struct bulk_piece {
+        const char * first;
+        const char * last;
+        const char * stop;
+        std::vector<Value> values;
+        bool failed;
+
+        bulk_piece(): first(0), last(0), stop(0), failed(false) {}
+
+        void operator()()
+        {
+            try {
+                this->stop =
+                    bulk_scan_run<ElementScanner>(this->first, this->last,
+                                                  this->values);
+            } catch (const std::bad_alloc &) {
+                this->failed = true;
+            }
+        }
+    };
+
+    //
+    // Scan using at most threads threads.  Returns the position following
+    // the last element; or 0 if the run is too small to split or the
+    // pieces do not line up, in which case values is unchanged.
+    //
+    template <typename ElementScanner, typename Value>
+    const char * bulk_scan_pieces(const char * const first,
+                                  const char * const last,
+                                  std::vector<Value> & values,
+                                  const unsigned int threads)
+    {
+        if (threads < 2 || last - first < 2 * bulk_min_piece_size) {
+            return 0;
+        }
+
+        //
+        // Estimate the extent of the run: up to the first "]" that is not
+        // in a comment.
+        //
+        const char * end = first;
+        for (;;) {
+            const void * const bracket = std::memchr(end, ']', last - end);
+            const char * const close =
+                bracket ? static_cast<const char *>(bracket) : last;
+            const void * const hash = std::memchr(end, '#', close - end);
+            if (!hash) {
+                end = close;
+                break;
+            }
+            end = static_cast<const char *>(hash);
+            while (end != last && *end != '\n' && *end != '\r') { ++end; }
+        }
+        const std::ptrdiff_t size = end - first;
+        if (size < 2 * bulk_min_piece_size) { return 0; }
+
+        const std::size_t max_pieces =
+            std::min(std::size_t(threads),
+                     std::size_t(size / bulk_min_piece_size));
+        if (max_pieces < 2) { return 0; }
+
+        std::vector<bulk_piece<ElementScanner, Value> > pieces(1);
+        pieces.back().first = first;
+        for (std::size_t i = 1; i < max_pieces; ++i) {
+            const char * const target =
+                std::max(pieces.back().first + 1,
+                         first + size * std::ptrdiff_t(i)
+                               / std::ptrdiff_t(max_pieces));
+            const char * const lf = std::find(target, end, '\n');
+            if (lf == end) { break; }
+            pieces.back().last = lf + 1;
+            pieces.push_back(bulk_piece<ElementScanner, Value>());
+            pieces.back().first = lf + 1;
+        }
+        pieces.back().last = last;
+        if (pieces.size() < 2) { return 0; }
+
+        boost::thread_group group;
+        try {
+            for (std::size_t i = 1; i < pieces.size(); ++i) {
+                group.create_thread(boost::ref(pieces[i]));
+            }
+        } catch (const boost::thread_resource_error &) {
+            group.join_all();
+            return 0;
+        }
+        pieces.front()();
+        group.join_all();
+
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < pieces.size(); ++i) {
+            if (pieces[i].failed) { return 0; }
+            if (i + 1 < pieces.size()) {
+                const char * pos = pieces[i].stop;
+                bulk_skip(pos, pieces[i].last);
+                if (pos != pieces[i].last) { return 0; }
+            }
+            count += pieces[i].values.size();
+        }
+
+        values.reserve(values.size() + count);
+        for (std::size_t i = 0; i < pieces.size(); ++i) {
+            values.insert(values.end(),
+                          pieces[i].values.begin(), pieces[i].values.end());
+        }
+        return pieces.back().stop;
+    }
+
+    //
+    // Only buffer_position_iterator is known to address a contiguous
+    // buffer; for any other iterator this does nothing and returns false.
+    //
+    template <typename ElementScanner, typename Iterator, typename Value>
+    bool bulk_scan_parallel(Iterator &, const Iterator &,
+                            std::vector<Value> &)
+    {
+        return false;
+    }
+
+    template <typename ElementScanner, typename Value>
+    bool bulk_scan_parallel(buffer_position_iterator & first,
+                            const buffer_position_iterator & last,
+                            std::vector<Value> & values)
+    {
+        if (first == last) { return false; }
+        static const unsigned int processors =
+            boost::thread::hardware_concurrency();
+        const char * const begin = &*first;
+        const char * const stop =
+            bulk_scan_pieces<ElementScanner>(begin, begin + (last - first),
+                                             values, processors);
+        if (!stop) { return false; }
+        first += stop - begin;
+        return true;
+    }
+
+
     struct bool_parser {
         typedef bool result_t;
 
@@ -334,6 +849,19 @@ namespace openvrml {
             int32_or_rbracket_expected;
     };
 
+    template <>
+    struct bulk_element_scanner<
+        boost::spirit::classic::functor_parser<int32_parser> > {
+        static const bool enabled = true;
+
+        template <typename Iterator>
+        static bool scan(Iterator & first, const Iterator & last,
+                         openvrml::int32 & value)
+        {
+            return bulk_scan_int32(first, last, value);
+        }
+    };
+
 
     struct intensity_parser {
 
@@ -409,6 +937,19 @@ namespace openvrml {
             color_or_rbracket_expected;
     };
 
+    template <>
+    struct bulk_element_scanner<
+        boost::spirit::classic::functor_parser<color_parser> > {
+        static const bool enabled = true;
+
+        template <typename Iterator>
+        static bool scan(Iterator & first, const Iterator & last,
+                         openvrml::color & value)
+        {
+            return bulk_scan_intensities(first, last, value.rgb);
+        }
+    };
+
 
     template <typename RotationNotNormalizedHandler>
     struct rotation_parser {
@@ -516,6 +1057,19 @@ namespace openvrml {
             vec2_or_rbracket_expected;
     };
 
+    template <>
+    struct bulk_element_scanner<
+        boost::spirit::classic::functor_parser<vec2f_parser> > {
+        static const bool enabled = true;
+
+        template <typename Iterator>
+        static bool scan(Iterator & first, const Iterator & last,
+                         openvrml::vec2f & value)
+        {
+            return bulk_scan_reals(first, last, value.vec);
+        }
+    };
+
 
     struct vec3f_parser {
 
@@ -550,6 +1104,19 @@ namespace openvrml {
             vec3_or_rbracket_expected;
     };
 
+    template <>
+    struct bulk_element_scanner<
+        boost::spirit::classic::functor_parser<vec3f_parser> > {
+        static const bool enabled = true;
+
+        template <typename Iterator>
+        static bool scan(Iterator & first, const Iterator & last,
+                         openvrml::vec3f & value)
+        {
+            return bulk_scan_reals(first, last, value.vec);
+        }
+    };
+
 
     struct image_parser {
 
@@ -618,8 +1185,10 @@ namespace openvrml {
                     // reallocation.
                     >> eps_p[resize_image(result, x, y, comp)]
                     >> repeat_p(ref(pixels))[
-                        expect_int32(int32_p)[set_pixel(result, index)]
-                                             [var(index) += 1]
+                        bulk_int32_p[set_pixel(result, index)]
+                                    [var(index) += 1]
+                        |   expect_int32(int32_p)[set_pixel(result, index)]
+                                                 [var(index) += 1]
                     ]
                 ;
             match_t match = rule.parse(scan);
@@ -1342,17 +1911,81 @@ namespace openvrml {
                         expect_element_or_rbracket(
                             get_mftype_parse_error<ElementParser>::element_or_rbracket_value);
 
-                    rule_t rule
-                        =   this->parser_[push_back_a(result)]
-                        |   expect_element_or_lbracket(ch_p('['))
-                            >> *(this->parser_[push_back_a(result)])
-                            >> expect_element_or_rbracket(ch_p(']'))
-                        ;
+                    rule_t rule;
+                    if (bulk_element_scanner<ElementParser>::enabled) {
+                        //
+                        // bulk_run_p takes as many elements as it can;
+                        // parser_ picks up (and reports errors for)
+                        // anything it leaves.
+                        //
+                        bool split = true;
+                        const boost::spirit::classic::functor_parser<
+                            bulk_run_parser>
+                            bulk_run_p = bulk_run_parser(result, split);
+                        rule
+                            =   this->parser_[push_back_a(result)]
+                            |   expect_element_or_lbracket(ch_p('['))
+                                >> bulk_run_p
+                                >> *(this->parser_[push_back_a(result)]
+                                     >> bulk_run_p)
+                                >> expect_element_or_rbracket(ch_p(']'))
+                            ;
+                    } else {
+                        rule
+                            =   this->parser_[push_back_a(result)]
+                            |   expect_element_or_lbracket(ch_p('['))
+                                >> *(this->parser_[push_back_a(result)])
+                                >> expect_element_or_rbracket(ch_p(']'))
+                            ;
+                    }
                     match_t match = rule.parse(scan);
                     return match.length();
                 }
 
             private:
+                struct bulk_run_parser {
+                    typedef boost::spirit::classic::nil_t result_t;
+
+                    bulk_run_parser(
+                        typename mftype_parser::result_t & values,
+                        bool & split):
+                        values_(&values),
+                        split_(&split)
+                    {}
+
+                    template <typename BulkRunScannerT>
+                    std::ptrdiff_t operator()(const BulkRunScannerT & scan,
+                                              result_t &) const
+                    {
+                        typedef typename BulkRunScannerT::iterator_t
+                            iterator_t;
+                        typedef bulk_element_scanner<ElementParser>
+                            element_scanner;
+                        iterator_t pos = scan.first;
+                        //
+                        // Only the first run (the one following "[") is
+                        // worth splitting; trying again after each element
+                        // the bulk scanners leave would rescan the rest of
+                        // the field each time.
+                        //
+                        if (*this->split_) {
+                            *this->split_ = false;
+                            bulk_scan_parallel<element_scanner>(
+                                pos, scan.last, *this->values_);
+                        }
+                        pos = bulk_scan_run<element_scanner>(
+                            pos, scan.last, *this->values_);
+                        const std::ptrdiff_t length =
+                            std::distance(scan.first, pos);
+                        scan.first = pos;
+                        return length;
+                    }
+
+                private:
+                    typename mftype_parser::result_t * values_;
+                    bool * split_;
+                };
+
                 const ElementParser & parser_;
             };
 
@@ -1578,6 +2211,8 @@ namespace openvrml {
                     void operator()(const IteratorT & first,
                                     const IteratorT & last) const
                     {
+                        using boost::spirit::classic::throw_;
+
                         const std::string node_name_id(first, last);
                         const defs_t::const_iterator pos =
                             this->scope_stack_.top().defs.find(node_name_id);
@@ -1646,6 +2281,8 @@ namespace openvrml {
                     void operator()(const IteratorT & first,
                                     const IteratorT & last) const
                     {
+                        using boost::spirit::classic::throw_;
+
                         const std::string node_type_id(first, last);
                         if (node_type_id == "Script") {
                             static const node_interface
@@ -1925,6 +2562,8 @@ namespace openvrml {
                 template <typename IteratorT>
                 void operator()(const IteratorT & first, IteratorT) const
                 {
+                    using boost::spirit::classic::throw_;
+
                     if (this->exists_) {
                         throw_(first, openvrml::node_type_already_exists);
                     }
@@ -2121,7 +2760,13 @@ namespace openvrml {
                 void operator()(IteratorT, IteratorT) const
                 {
                     vrml97_grammar_def_t & d = this->vrml97_grammar_def_;
-                    d.field_value = d.field_value_rule_stack.top().copy();
+                    //
+                    // Assign the stored_rule itself rather than a copy() of
+                    // it: assigning a copy() wraps it in a new parser, so
+                    // each node would add a level to a chain that is
+                    // destroyed recursively.
+                    //
+                    d.field_value = d.field_value_rule_stack.top();
                     d.field_value_rule_stack.pop();
                 }
 
@@ -176,6 +176,19 @@ namespace openvrml {
             color_rgba_or_rbracket_expected;
     };
 
+    template <>
+    struct bulk_element_scanner<
+        boost::spirit::classic::functor_parser<color_rgba_parser> > {
+        static const bool enabled = true;
+
+        template <typename Iterator>
+        static bool scan(Iterator & first, const Iterator & last,
+                         openvrml::color_rgba & value)
+        {
+            return bulk_scan_intensities(first, last, value.rgba);
+        }
+    };
+
 
     struct vec2d_parser {
 
@@ -210,6 +223,19 @@ namespace openvrml {
             vec2_or_rbracket_expected;
     };
 
+    template <>
+    struct bulk_element_scanner<
+        boost::spirit::classic::functor_parser<vec2d_parser> > {
+        static const bool enabled = true;
+
+        template <typename Iterator>
+        static bool scan(Iterator & first, const Iterator & last,
+                         openvrml::vec2d & value)
+        {
+            return bulk_scan_reals(first, last, value.vec);
+        }
+    };
+
 
     struct vec3d_parser {
 
@@ -245,6 +271,19 @@ namespace openvrml {
             vec3_or_rbracket_expected;
     };
 
+    template <>
+    struct bulk_element_scanner<
+        boost::spirit::classic::functor_parser<vec3d_parser> > {
+        static const bool enabled = true;
+
+        template <typename Iterator>
+        static bool scan(Iterator & first, const Iterator & last,
+                         openvrml::vec3d & value)
+        {
+            return bulk_scan_reals(first, last, value.vec);
+        }
+    };
+
 
     struct null_x3d_vrml_parse_actions : null_vrml97_parse_actions {
         struct on_profile_statement_t {
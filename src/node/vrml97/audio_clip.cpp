@@ -25,6 +25,7 @@
 # include <openvrml/node_impl_util.h>
 # include <openvrml/scene.h>
 # include <boost/array.hpp>
+# include <limits>
 
 # ifdef HAVE_CONFIG_H
 #   include <config.h>
@@ -65,6 +66,7 @@ namespace {
         virtual void do_initialize(double timestamp) OPENVRML_THROW1(std::bad_alloc);
         virtual void do_shutdown(double timestamp) OPENVRML_NOTHROW;
         virtual void do_update(double time);
+        virtual double do_next_update_time() const;
     };
 
 
@@ -184,6 +186,18 @@ namespace {
     void audio_clip_node::do_update(double)
     {}
 
+    /**
+     * @brief The time at which the node next needs to be updated.
+     *
+     * Since @c #do_update does nothing, never.
+     *
+     * @return infinity.
+     */
+    double audio_clip_node::do_next_update_time() const
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+
     /**
      * @brief Initialize.
      *
@@ -62,9 +62,6 @@ namespace {
         virtual ~cad_layer_node() OPENVRML_NOTHROW;
 
     private:
-        virtual bool do_modified() const
-            OPENVRML_THROW1(boost::thread_resource_error);
-
         virtual
         void do_children_event_side_effect(const openvrml::mfnode & choice,
                                            double timestamp)
@@ -227,24 +224,6 @@ namespace {
     }
 
 
-    /**
-     * @brief Determine whether the node has been modified.
-     *
-     * @return @c true if the node or one of its children has been modified,
-     *      @c false otherwise.
-     */
-    bool cad_layer_node::do_modified() const
-        OPENVRML_THROW1(boost::thread_resource_error)
-    {
-        for (openvrml::mfnode::value_type::const_iterator child =
-                 current_children_.value().begin();
-             child != current_children_.value().end();
-             ++child) {
-            if ((*child)->modified()) { return true; }
-        }
-        return false;
-    }
-
     /**
      * @brief Render the node.
      *
@@ -47,10 +47,6 @@ namespace {
         collision_node(const openvrml::node_type & type,
                        const boost::shared_ptr<openvrml::scope> & scope);
         virtual ~collision_node() OPENVRML_NOTHROW;
-
-    private:
-        virtual bool do_modified() const
-            OPENVRML_THROW1(boost::thread_resource_error);
     };
 
 
@@ -114,20 +110,6 @@ namespace {
      */
     collision_node::~collision_node() OPENVRML_NOTHROW
     {}
-
-    /**
-     * @brief Determine whether the node has been modified.
-     *
-     * @return @c true if the node or one of its children has been modified,
-     *      @c false otherwise.
-     */
-    bool collision_node::do_modified() const
-        OPENVRML_THROW1(boost::thread_resource_error)
-    {
-        return (this->proxy_.value() && this->proxy_.value()->modified())
-            || (this->openvrml_node_vrml97::grouping_node_base<collision_node>::
-                do_modified());
-    }
 }
 
 /**
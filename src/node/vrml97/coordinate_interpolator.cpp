@@ -160,7 +160,7 @@ namespace {
                 }
             }
 
-            node.value_.mfvec3f::value(value);
+            node.value_.mfvec3f::take_value(value);
 
             // Send the new value
             node::emit_event(node.value_changed_, timestamp);
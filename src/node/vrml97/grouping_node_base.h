@@ -104,9 +104,6 @@ namespace openvrml_node_vrml97 {
         virtual ~grouping_node_base() OPENVRML_NOTHROW;
 
     protected:
-        virtual bool do_modified() const
-            OPENVRML_THROW1(boost::thread_resource_error);
-
         virtual void do_render_child(openvrml::viewer & viewer,
                                      openvrml::rendering_context context);
         virtual const openvrml::bounding_volume &
@@ -172,6 +169,7 @@ namespace openvrml_node_vrml97 {
 
         typedef std::vector<boost::intrusive_ptr<openvrml::node> > children_t;
         children_t children = group.children_.value();
+        children_t added;
 
         for (children_t::const_iterator n = value.value().begin();
              n != value.value().end();
@@ -198,12 +196,14 @@ namespace openvrml_node_vrml97 {
                     if (child) {
                         child->relocate(); // Throws std::bad_alloc.
                     }
+                    added.push_back(*n); // Throws std::bad_alloc.
                     succeeded = true;
                 }
             }
         }
 
         group.children_.value(children);
+        group.relink_children(mfnode(), mfnode(added));
 
         group.node::modified(true);
         group.bounding_volume_dirty(true);
@@ -255,16 +255,22 @@ namespace openvrml_node_vrml97 {
 
         typedef std::vector<boost::intrusive_ptr<openvrml::node> > children_t;
         children_t children = group.children_.mfnode::value();
+        children_t removed;
 
         for (children_t::const_iterator n = value.value().begin();
              n != value.value().end();
              ++n) {
+            using std::count;
             using std::remove;
+            removed.insert(removed.end(),
+                           count(children.begin(), children.end(), *n),
+                           *n);
             children.erase(remove(children.begin(), children.end(), *n),
                            children.end());
         }
 
         group.children_.mfnode::value(children);
+        group.relink_children(mfnode(removed), mfnode());
 
         group.node::modified(true);
         group.bounding_volume_dirty(true);
@@ -448,22 +454,6 @@ namespace openvrml_node_vrml97 {
     grouping_node_base<Derived>::~grouping_node_base() OPENVRML_NOTHROW
     {}
 
-    /**
-     * @brief Determine whether the node has been modified.
-     *
-     * @return @c true if one of the node's children has been modified,
-     *         @c false otherwise.
-     */
-    template <typename Derived>
-    bool grouping_node_base<Derived>::do_modified() const
-        OPENVRML_THROW1(boost::thread_resource_error)
-    {
-        for (size_t i = 0; i < this->children_.value().size(); ++i) {
-            if (this->children_.value()[i]->modified()) { return true; }
-        }
-        return false;
-    }
-
     /**
      * @brief Render the node.
      *
@@ -46,9 +46,6 @@ namespace {
         virtual ~lod_node() OPENVRML_NOTHROW;
 
     private:
-        virtual bool do_modified() const
-            OPENVRML_THROW1(boost::thread_resource_error);
-
          virtual void do_render_child(openvrml::viewer & viewer,
                                      openvrml::rendering_context context);
         virtual const std::vector<boost::intrusive_ptr<openvrml::node> >
@@ -111,19 +108,6 @@ namespace {
     lod_node::~lod_node() OPENVRML_NOTHROW
     {}
 
-    /**
-     * @brief Determine whether the node has been modified.
-     *
-     * @return @c true if the node or one of its children has been modified,
-     *         @c false otherwise.
-     */
-    bool lod_node::do_modified() const
-        OPENVRML_THROW1(boost::thread_resource_error)
-    {
-        return !this->current_children_.value().empty()
-            && this->current_children_.value()[0]->modified();
-    }
-
     /**
      * @brief Render the node.
      *
@@ -25,6 +25,7 @@
 # include <openvrml/scene.h>
 # include <private.h>
 # include <boost/array.hpp>
+# include <limits>
 
 # ifdef HAVE_CONFIG_H
 #   include <config.h>
@@ -84,6 +85,7 @@ namespace {
         virtual void do_render_texture(openvrml::viewer & v);
 
         virtual void do_update(double time);
+        virtual double do_next_update_time() const;
     };
 
     /**
@@ -409,6 +411,19 @@ namespace {
 # endif
     }
 
+    /**
+     * @brief The time at which the node next needs to be updated.
+     *
+     * Movie playback is not implemented and @c #do_update does nothing; so
+     * the node never needs to be updated.
+     *
+     * @return infinity.
+     */
+    double movie_texture_node::do_next_update_time() const
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+
     /**
      * @brief The image.
      *
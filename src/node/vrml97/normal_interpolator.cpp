@@ -180,7 +180,7 @@ namespace {
                 }
             }
 
-            node.value_changed_.mfvec3f::value(value);
+            node.value_changed_.mfvec3f::take_value(value);
 
             // Send the new value
             node::emit_event(node.value_changed_emitter_, timestamp);
@@ -59,9 +59,6 @@ namespace {
         virtual ~switch_node() OPENVRML_NOTHROW;
 
     private:
-        virtual bool do_modified() const
-            OPENVRML_THROW1(boost::thread_resource_error);
-
         virtual void do_children_event_side_effect(const openvrml::mfnode & choice,
                                                    double timestamp)
             OPENVRML_THROW1(std::bad_alloc);
@@ -198,7 +195,7 @@ namespace {
                      < openvrml::int32(n.children_.mfnode::value().size())))
                 ? n.children_.mfnode::value()[which_choice.value()]
                 : children_t::value_type(0);
-            n.current_children_.mfnode::value(children);
+            n.current_children_.mfnode::take_value(children);
         } catch (std::bad_cast & ex) {
             OPENVRML_PRINT_EXCEPTION_(ex);
         }
@@ -236,20 +233,6 @@ namespace {
     switch_node::~switch_node() OPENVRML_NOTHROW
     {}
 
-    /**
-     * @brief Determine whether the node has been modified.
-     *
-     * @return @c true if one of the node's rendered children has been
-     *         modified, @c false otherwise.
-     */
-    bool switch_node::do_modified() const
-        OPENVRML_THROW1(boost::thread_resource_error)
-    {
-        const openvrml::int32 w = this->which_choice_.value();
-        return w >= 0 && static_cast<size_t>(w) < this->children_.value().size()
-            && this->children_.value()[w]->modified();
-    }
-
     /**
      * @brief Render the node.
      *
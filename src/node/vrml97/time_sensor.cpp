@@ -26,6 +26,7 @@
 # include <openvrml/node_impl_util.h>
 # include <openvrml/scene.h>
 # include <boost/array.hpp>
+# include <limits>
 
 # ifdef HAVE_CONFIG_H
 #   include <config.h>
@@ -118,6 +119,7 @@ namespace {
             OPENVRML_THROW1(std::bad_alloc);
         virtual void do_shutdown(double timestamp) OPENVRML_NOTHROW;
         virtual void do_update(double time);
+        virtual double do_next_update_time() const;
     };
 
     /**
@@ -296,6 +298,7 @@ namespace {
                 node.is_active_ = enabled;
                 node::emit_event(node.is_active_emitter_, timestamp);
             }
+            node.reschedule();
         } catch (std::bad_cast & ex) {
             OPENVRML_PRINT_EXCEPTION_(ex);
         }
@@ -350,6 +353,7 @@ namespace {
                 node.start_time_ = start_time;
                 node.lastTime = timestamp;
                 node::emit_event(node.start_time_changed_emitter_, timestamp);
+                node.reschedule();
             }
         } catch (std::bad_cast & ex) {
             OPENVRML_PRINT_EXCEPTION_(ex);
@@ -612,6 +616,26 @@ namespace {
         }
     }
 
+    /**
+     * @brief The time at which the node next needs to be updated.
+     *
+     * An active TimeSensor is updated every frame.  An inactive one can only
+     * become active at its startTime, and then only if startTime has not
+     * already passed; the set_startTime and enabled handlers reschedule the
+     * node.
+     *
+     * @return the time at which the node next needs to be updated.
+     */
+    double time_sensor_node::do_next_update_time() const
+    {
+        const double never = std::numeric_limits<double>::infinity();
+        if (!this->enabled_.sfbool::value()) { return never; }
+        if (this->is_active_.value()) { return -never; }
+        return (this->start_time_.value() >= this->lastTime)
+            ? this->start_time_.value()
+            : never;
+    }
+
     /**
      * @brief Initialize.
      *
@@ -55,9 +55,6 @@ namespace {
         virtual ~static_group_node() OPENVRML_NOTHROW;
 
     protected:
-        virtual bool do_modified() const
-            OPENVRML_THROW1(boost::thread_resource_error);
-
         virtual void do_render_child(openvrml::viewer & viewer,
                                      rendering_context context);
         virtual const openvrml::bounding_volume &
@@ -108,21 +105,6 @@ namespace {
         return this->children_.value();
     }
 
-    /**
-     * @brief Determine whether the node has been modified.
-     *
-     * @return @c true if the node or one of its children has been modified,
-     *      @c false otherwise.
-     */
-    bool static_group_node::do_modified() const
-        OPENVRML_THROW1(boost::thread_resource_error)
-    {
-        for (size_t i = 0; i < this->children_.value().size(); ++i) {
-            if (this->children_.value()[i]->modified()) { return true; }
-        }
-        return false;
-    }
-
     /**
      * @brief Render the node.
      *
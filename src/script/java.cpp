@@ -4232,7 +4232,7 @@ namespace {
         }
         typename FieldValue::value_type temp = mf.value();
         temp.erase(temp.begin() + index);
-        mf.value(temp);
+        mf.take_value(temp);
     }
 }
 
@@ -4340,7 +4340,7 @@ namespace {
         try {
             typename FieldValue::value_type temp = mf.value();
             temp.at(index) = value;
-            mf.value(temp);
+            mf.take_value(temp);
         } catch (std::out_of_range & ex) {
             throw_array_index_out_of_bounds(env, ex.what());
         } catch (std::bad_alloc & ex) {
@@ -4373,7 +4373,7 @@ namespace {
         try {
             typename FieldValue::value_type temp = mf.value();
             temp.push_back(value);
-            mf.value(temp);
+            mf.take_value(temp);
         } catch (std::bad_alloc & ex) {
             throw_out_of_memory(env, ex.what());
         }
@@ -4415,7 +4415,7 @@ namespace {
         try {
             typename FieldValue::value_type temp = mf.value();
             temp.insert(temp.begin() + index, value);
-            mf.value(temp);
+            mf.take_value(temp);
         } catch (std::bad_alloc & ex) {
             throw_out_of_memory(env, ex.what());
         }
@@ -4952,7 +4952,7 @@ void JNICALL Java_vrml_field_MFFloat_delete(JNIEnv * const env,
         }
         mffloat::value_type temp = mff.value();
         temp.erase(temp.begin() + index);
-        mff.value(temp);
+        mff.take_value(temp);
     } catch (std::exception & ex) {
         OPENVRML_PRINT_EXCEPTION_(ex);
     }
@@ -5456,7 +5456,7 @@ void JNICALL Java_vrml_field_MFNode_peer_1delete(JNIEnv * const env,
     try {
         openvrml::mfnode::value_type temp = mfn->value();
         temp.erase(temp.begin() + index);
-        mfn->value(temp);
+        mfn->take_value(temp);
     } catch (std::bad_alloc & ex) {
         throw_out_of_memory(*env, ex.what());
     }
@@ -5551,7 +5551,7 @@ void JNICALL Java_vrml_field_MFNode_peer_1set1Value(JNIEnv * const env,
         try {
             mfnode::value_type temp = mfn->value();
             temp.at(index) = node_peer;
-            mfn->value(temp);
+            mfn->take_value(temp);
         } catch (std::bad_alloc & ex) {
             throw_out_of_memory(*env, ex.what());
         } catch (std::out_of_range & ex) {
@@ -5588,7 +5588,7 @@ void JNICALL Java_vrml_field_MFNode_peer_1addValue(JNIEnv * const env,
         try {
             mfnode::value_type temp = mfn->value();
             temp.push_back(node_peer);
-            mfn->value(temp);
+            mfn->take_value(temp);
         } catch (std::bad_alloc & ex) {
             throw_out_of_memory(*env, ex.what());
         }
@@ -5617,7 +5617,7 @@ void JNICALL Java_vrml_field_MFNode_peer_1insertValue(JNIEnv * const env,
         try {
             mfnode::value_type temp = mfn->value();
             temp.insert(temp.begin() + index, node_peer);
-            mfn->value(temp);
+            mfn->take_value(temp);
         } catch (std::bad_alloc & ex) {
             throw_out_of_memory(*env, ex.what());
         }
@@ -6142,7 +6142,7 @@ Java_vrml_field_MFString_set1Value__ILjava_lang_String_2(JNIEnv * const env,
             } BOOST_SCOPE_EXIT_END
             mfstring::value_type temp = mfstr.value();
             temp.at(index) = utf8chars;
-            mfstr.value(temp);
+            mfstr.take_value(temp);
         } catch (std::out_of_range & ex) {
             throw_array_index_out_of_bounds(*env, ex.what());
         } catch (std::bad_alloc & ex) {
@@ -6176,7 +6176,7 @@ Java_vrml_field_MFString_addValue__Ljava_lang_String_2(JNIEnv * env,
             } BOOST_SCOPE_EXIT_END
             mfstring::value_type temp = mfstr.value();
             temp.push_back(utf8chars);
-            mfstr.value(temp);
+            mfstr.take_value(temp);
         } catch (std::out_of_range & ex) {
             throw_array_index_out_of_bounds(*env, ex.what());
         } catch (std::bad_alloc & ex) {
@@ -6212,7 +6212,7 @@ Java_vrml_field_MFString_insertValue__ILjava_lang_String_2(JNIEnv * const env,
             } BOOST_SCOPE_EXIT_END
             mfstring::value_type temp = mfstr.value();
             temp.insert(temp.begin() + index, utf8chars);
-            mfstr.value(temp);
+            mfstr.take_value(temp);
         } catch (std::out_of_range & ex) {
             throw_array_index_out_of_bounds(*env, ex.what());
         } catch (std::bad_alloc & ex) {
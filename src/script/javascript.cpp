@@ -5867,13 +5867,13 @@ namespace {
             static_cast<MField::MFData *>(js_get_private(cx, obj));
         assert(mfdata);
         std::auto_ptr<openvrml::mfbool>
-            mfbool(new openvrml::mfbool(mfdata->array.size()));
-        std::vector<bool> temp = mfbool->value();
+            mfbool(new openvrml::mfbool);
+        std::vector<bool> temp(mfdata->array.size());
         for (MField::JsvalArray::size_type i = 0; i < mfdata->array.size(); ++i) {
             assert(JSVAL_IS_BOOLEAN(mfdata->array[i]));
             temp[i] = JSVAL_TO_BOOLEAN(mfdata->array[i]);
         }
-        mfbool->value(temp);
+        mfbool->take_value(temp);
         return mfbool;
     }
 
@@ -6078,8 +6078,8 @@ namespace {
             static_cast<MField::MFData *>(js_get_private(cx, obj));
         assert(mfdata);
         std::auto_ptr<openvrml::mfcolor>
-            mfcolor(new openvrml::mfcolor(mfdata->array.size()));
-        std::vector<openvrml::color> temp = mfcolor->value();
+            mfcolor(new openvrml::mfcolor);
+        std::vector<openvrml::color> temp(mfdata->array.size());
         for (MField::JsvalArray::size_type i = 0; i < mfdata->array.size(); ++i) {
             assert(jsval_is_object_or_null(mfdata->array[i]));
             assert(JS_InstanceOf(cx, JSVAL_TO_OBJECT(mfdata->array[i]),
@@ -6093,7 +6093,7 @@ namespace {
                 static_cast<openvrml::sfcolor &>(sfdata->field_value());
             temp[i] = sfcolor.value();
         }
-        mfcolor->value(temp);
+        mfcolor->take_value(temp);
         return mfcolor;
     }
 
@@ -6188,13 +6188,13 @@ namespace {
             static_cast<MField::MFData *>(js_get_private(cx, obj));
         assert(mfdata);
         std::auto_ptr<openvrml::mffloat>
-            mffloat(new openvrml::mffloat(mfdata->array.size()));
-        std::vector<float> temp = mffloat->value();
+            mffloat(new openvrml::mffloat);
+        std::vector<float> temp(mfdata->array.size());
         for (MField::JsvalArray::size_type i = 0; i < mfdata->array.size(); ++i) {
             assert(JSVAL_IS_DOUBLE(mfdata->array[i]));
             temp[i] = float(jsval_to_double(mfdata->array[i]));
         }
-        mffloat->value(temp);
+        mffloat->take_value(temp);
         return mffloat;
     }
 
@@ -6263,13 +6263,13 @@ namespace {
             static_cast<MField::MFData *>(js_get_private(cx, obj));
         assert(mfdata);
         std::auto_ptr<openvrml::mfdouble>
-            mfdouble(new openvrml::mfdouble(mfdata->array.size()));
-        std::vector<double> temp = mfdouble->value();
+            mfdouble(new openvrml::mfdouble);
+        std::vector<double> temp(mfdata->array.size());
         for (MField::JsvalArray::size_type i = 0; i < mfdata->array.size(); ++i) {
             assert(JSVAL_IS_DOUBLE(mfdata->array[i]));
             temp[i] = jsval_to_double(mfdata->array[i]);
         }
-        mfdouble->value(temp);
+        mfdouble->take_value(temp);
         return mfdouble;
     }
 
@@ -6357,13 +6357,13 @@ namespace {
             static_cast<MField::MFData *>(js_get_private(cx, obj));
         assert(mfdata);
         std::auto_ptr<openvrml::mfint32>
-            mfint32(new openvrml::mfint32(mfdata->array.size()));
-        std::vector<openvrml::int32> temp = mfint32->value();
+            mfint32(new openvrml::mfint32);
+        std::vector<openvrml::int32> temp(mfdata->array.size());
         for (MField::JsvalArray::size_type i = 0; i < mfdata->array.size(); ++i) {
             assert(JSVAL_IS_INT(mfdata->array[i]));
             temp[i] = JSVAL_TO_INT(mfdata->array[i]);
         }
-        mfint32->value(temp);
+        mfint32->take_value(temp);
         return mfint32;
     }
 
@@ -6634,8 +6634,8 @@ namespace {
             static_cast<MField::MFData *>(js_get_private(cx, obj));
         assert(mfdata);
         std::auto_ptr<openvrml::mfnode>
-            mfnode(new openvrml::mfnode(mfdata->array.size()));
-        std::vector<boost::intrusive_ptr<openvrml::node> > temp = mfnode->value();
+            mfnode(new openvrml::mfnode);
+        std::vector<boost::intrusive_ptr<openvrml::node> > temp(mfdata->array.size());
         for (MField::JsvalArray::size_type i = 0; i < mfdata->array.size(); ++i) {
             assert(jsval_is_object_or_null(mfdata->array[i]));
             assert(JS_InstanceOf(cx, JSVAL_TO_OBJECT(mfdata->array[i]),
@@ -6649,7 +6649,7 @@ namespace {
                 static_cast<openvrml::sfnode &>(sfdata->field_value());
             temp[i] = sfnode.value();
         }
-        mfnode->value(temp);
+        mfnode->take_value(temp);
         return mfnode;
     }
 
@@ -6885,8 +6885,8 @@ namespace {
             static_cast<MField::MFData *>(js_get_private(cx, obj));
         assert(mfdata);
         std::auto_ptr<openvrml::mfrotation>
-            mfrotation(new openvrml::mfrotation(mfdata->array.size()));
-        std::vector<openvrml::rotation> temp = mfrotation->value();
+            mfrotation(new openvrml::mfrotation);
+        std::vector<openvrml::rotation> temp(mfdata->array.size());
         for (MField::JsvalArray::size_type i = 0; i < mfdata->array.size(); ++i) {
             assert(jsval_is_object_or_null(mfdata->array[i]));
             assert(JS_InstanceOf(cx, JSVAL_TO_OBJECT(mfdata->array[i]),
@@ -6900,7 +6900,7 @@ namespace {
                 static_cast<openvrml::sfrotation &>(sfdata->field_value());
             temp[i] = sfrotation.value();
         }
-        mfrotation->value(temp);
+        mfrotation->take_value(temp);
         return mfrotation;
     }
 
@@ -6988,15 +6988,15 @@ namespace {
             static_cast<MField::MFData *>(js_get_private(cx, obj));
         assert(mfdata);
         std::auto_ptr<openvrml::mfstring>
-            mfstring(new openvrml::mfstring(mfdata->array.size()));
-        std::vector<std::string> temp = mfstring->value();
+            mfstring(new openvrml::mfstring);
+        std::vector<std::string> temp(mfdata->array.size());
         for (MField::JsvalArray::size_type i = 0; i < mfdata->array.size(); ++i) {
             assert(JSVAL_IS_STRING(mfdata->array[i]));
             const char * const str =
                 JS_EncodeString(cx, JSVAL_TO_STRING(mfdata->array[i]));
             temp[i] = str;
         }
-        mfstring->value(temp);
+        mfstring->take_value(temp);
         return mfstring;
     }
 
@@ -7233,13 +7233,13 @@ namespace {
             static_cast<MField::MFData *>(js_get_private(cx, obj));
         assert(mfdata);
         std::auto_ptr<openvrml::mftime>
-            mftime(new openvrml::mftime(mfdata->array.size()));
-        std::vector<double> temp = mftime->value();
+            mftime(new openvrml::mftime);
+        std::vector<double> temp(mfdata->array.size());
         for (MField::JsvalArray::size_type i = 0; i < mfdata->array.size(); ++i) {
             assert(JSVAL_IS_DOUBLE(mfdata->array[i]));
             temp[i] = jsval_to_double(mfdata->array[i]);
         }
-        mftime->value(temp);
+        mftime->take_value(temp);
         return mftime;
     }
 
@@ -7305,8 +7305,8 @@ namespace {
             static_cast<MField::MFData *>(js_get_private(cx, obj));
         assert(mfdata);
         std::auto_ptr<openvrml::mfvec2f>
-            mfvec2f(new openvrml::mfvec2f(mfdata->array.size()));
-        std::vector<openvrml::vec2f> temp = mfvec2f->value();
+            mfvec2f(new openvrml::mfvec2f);
+        std::vector<openvrml::vec2f> temp(mfdata->array.size());
         for (MField::JsvalArray::size_type i = 0; i < mfdata->array.size(); ++i) {
             assert(jsval_is_object_or_null(mfdata->array[i]));
             assert(JS_InstanceOf(cx, JSVAL_TO_OBJECT(mfdata->array[i]),
@@ -7320,7 +7320,7 @@ namespace {
                 static_cast<openvrml::sfvec2f &>(sfdata->field_value());
             temp[i] = sfvec2f.value();
         }
-        mfvec2f->value(temp);
+        mfvec2f->take_value(temp);
         return mfvec2f;
     }
 
@@ -7386,8 +7386,8 @@ namespace {
             static_cast<MField::MFData *>(js_get_private(cx, obj));
         assert(mfdata);
         std::auto_ptr<openvrml::mfvec2d>
-            mfvec2d(new openvrml::mfvec2d(mfdata->array.size()));
-        std::vector<openvrml::vec2d> temp = mfvec2d->value();
+            mfvec2d(new openvrml::mfvec2d);
+        std::vector<openvrml::vec2d> temp(mfdata->array.size());
         for (MField::JsvalArray::size_type i = 0; i < mfdata->array.size(); ++i) {
             assert(jsval_is_object_or_null(mfdata->array[i]));
             assert(JS_InstanceOf(cx, JSVAL_TO_OBJECT(mfdata->array[i]),
@@ -7401,7 +7401,7 @@ namespace {
                 static_cast<openvrml::sfvec2d &>(sfdata->field_value());
             temp[i] = sfvec2d.value();
         }
-        mfvec2d->value(temp);
+        mfvec2d->take_value(temp);
         return mfvec2d;
     }
 
@@ -7467,8 +7467,8 @@ namespace {
             static_cast<MField::MFData *>(js_get_private(cx, obj));
         assert(mfdata);
         std::auto_ptr<openvrml::mfvec3f>
-            mfvec3f(new openvrml::mfvec3f(mfdata->array.size()));
-        std::vector<openvrml::vec3f> temp = mfvec3f->value();
+            mfvec3f(new openvrml::mfvec3f);
+        std::vector<openvrml::vec3f> temp(mfdata->array.size());
         for (MField::JsvalArray::size_type i = 0;
              i < mfdata->array.size(); ++i) {
             assert(jsval_is_object_or_null(mfdata->array[i]));
@@ -7483,7 +7483,7 @@ namespace {
                 static_cast<openvrml::sfvec3f &>(sfdata->field_value());
             temp[i] = sfvec3f.value();
         }
-        mfvec3f->value(temp);
+        mfvec3f->take_value(temp);
         return mfvec3f;
     }
 
@@ -7549,8 +7549,8 @@ namespace {
             static_cast<MField::MFData *>(js_get_private(cx, obj));
         assert(mfdata);
         std::auto_ptr<openvrml::mfvec3d>
-            mfvec3d(new openvrml::mfvec3d(mfdata->array.size()));
-        std::vector<openvrml::vec3d> temp = mfvec3d->value();
+            mfvec3d(new openvrml::mfvec3d);
+        std::vector<openvrml::vec3d> temp(mfdata->array.size());
         for (MField::JsvalArray::size_type i = 0;
              i < mfdata->array.size(); ++i) {
             assert(jsval_is_object_or_null(mfdata->array[i]));
@@ -7565,7 +7565,7 @@ namespace {
                 static_cast<openvrml::sfvec3d &>(sfdata->field_value());
             temp[i] = sfvec3d.value();
         }
-        mfvec3d->value(temp);
+        mfvec3d->take_value(temp);
         return mfvec3d;
     }
 
@@ -0,0 +1,95 @@
+// -*- mode: c++; indent-tabs-mode: nil; c-basic-offset: 4; fill-column: 78 -*-
+//
+// Copyright 2026  Braden McDaniel
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation; either version 3 of the License, or (at your option)
+// any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this library; if not, see <http://www.gnu.org/licenses/>.
+//
+
+//
+// Measure event throughput through a ROUTE fan-out: one Transform's
+// translation_changed is routed to the set_translation of a large number of
+// other Transforms, and events are sent to the source Transform.  This
+// exercises the per-listener dispatch in event_emitter::emit_event.
+//
+// Usage: bench-event-fanout [fan-out [iterations]]
+//
+
+# include <cstdlib>
+# include <iostream>
+# include <sstream>
+# include <boost/date_time/posix_time/posix_time_types.hpp>
+# include <boost/lexical_cast.hpp>
+# include "test_resource_fetcher.h"
+
+using namespace std;
+using namespace openvrml;
+
+int main(int argc, char * argv[])
+{
+    using boost::lexical_cast;
+    using boost::posix_time::microsec_clock;
+    using boost::posix_time::ptime;
+
+    const size_t fan_out = (argc > 1) ? lexical_cast<size_t>(argv[1]) : 1000;
+    const size_t iterations =
+        (argc > 2) ? lexical_cast<size_t>(argv[2]) : 1000;
+
+    test_resource_fetcher fetcher;
+    browser b(fetcher, std::cout, std::cerr);
+
+    stringstream vrmlstream;
+    vrmlstream << "DEF S Transform {}\n";
+    for (size_t i = 0; i < fan_out; ++i) {
+        vrmlstream << "DEF T" << i << " Transform {}\n"
+                   << "ROUTE S.translation_changed TO T" << i
+                   << ".set_translation\n";
+    }
+    const vector<boost::intrusive_ptr<node> > nodes =
+        b.create_vrml_from_stream(vrmlstream);
+    b.replace_world(nodes);
+
+    sfvec3f_listener & set_translation =
+        nodes.front()->event_listener<sfvec3f>("set_translation");
+
+    //
+    // Each event gets a distinct timestamp; the browser drops a second event
+    // from the same eventOut with the same timestamp.
+    //
+    double timestamp = browser::current_time();
+    const ptime start = microsec_clock::universal_time();
+    for (size_t i = 0; i < iterations; ++i) {
+        set_translation.process_event(
+            sfvec3f(make_vec3f(float(i), 0.0, 0.0)),
+            timestamp += 1.0);
+    }
+    const ptime stop = microsec_clock::universal_time();
+
+    const vec3f expected = make_vec3f(float(iterations - 1), 0.0, 0.0);
+    const vec3f actual =
+        nodes.back()->field<sfvec3f>("translation").value();
+    if (iterations > 0 && !(actual == expected)) {
+        cerr << argv[0] << ": expected final translation " << expected
+             << "; got " << actual << endl;
+        return EXIT_FAILURE;
+    }
+
+    const double seconds = (stop - start).total_microseconds() / 1.0e6;
+    const double events = double(iterations) * fan_out;
+    cout << "delivered " << events << " events (" << iterations
+         << " x fan-out " << fan_out << ") in " << seconds << " s ("
+         << (seconds > 0.0 ? events / seconds : 0.0) << " events/s)"
+         << endl;
+
+    return EXIT_SUCCESS;
+}
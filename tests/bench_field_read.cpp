@@ -0,0 +1,73 @@
+// -*- mode: c++; indent-tabs-mode: nil; c-basic-offset: 4; fill-column: 78 -*-
+//
+// Copyright 2026  Braden McDaniel
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation; either version 3 of the License, or (at your option)
+// any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this library; if not, see <http://www.gnu.org/licenses/>.
+//
+
+//
+// Measure the cost of reading a large mfvec3f one element at a time through
+// field_value::value, as node implementations commonly do.  Every element
+// read is a separate call to value(); so this is dominated by the cost of
+// the field value read path.
+//
+// Usage: bench-field-read [element-count [iterations]]
+//
+
+# include <cstdlib>
+# include <iostream>
+# include <boost/date_time/posix_time/posix_time_types.hpp>
+# include <boost/lexical_cast.hpp>
+# include <openvrml/field_value.h>
+
+using namespace std;
+using namespace openvrml;
+
+int main(int argc, char * argv[])
+{
+    using boost::lexical_cast;
+    using boost::posix_time::microsec_clock;
+    using boost::posix_time::ptime;
+
+    const size_t element_count =
+        (argc > 1) ? lexical_cast<size_t>(argv[1]) : 1000000;
+    const size_t iterations =
+        (argc > 2) ? lexical_cast<size_t>(argv[2]) : 10;
+
+    const mfvec3f points(mfvec3f::value_type(element_count,
+                                             make_vec3f(1.0, 2.0, 3.0)));
+
+    const ptime start = microsec_clock::universal_time();
+    double sum = 0.0;
+    for (size_t i = 0; i < iterations; ++i) {
+        for (size_t j = 0; j < points.value().size(); ++j) {
+            sum += points.value()[j].x();
+        }
+    }
+    const ptime stop = microsec_clock::universal_time();
+
+    if (sum != double(element_count * iterations)) {
+        cerr << argv[0] << ": expected sum " << element_count * iterations
+             << "; got " << sum << endl;
+        return EXIT_FAILURE;
+    }
+
+    const double seconds = (stop - start).total_microseconds() / 1.0e6;
+    cout << "read " << iterations << " x " << element_count
+         << " mfvec3f elements in " << seconds << " s ("
+         << (seconds > 0.0 ? element_count * iterations / seconds : 0.0)
+         << " elements/s)" << endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,89 @@
+// -*- mode: c++; indent-tabs-mode: nil; c-basic-offset: 4; fill-column: 78 -*-
+//
+// Copyright 2026  Braden McDaniel
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation; either version 3 of the License, or (at your option)
+// any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this library; if not, see <http://www.gnu.org/licenses/>.
+//
+
+//
+// Measure the cost of copying large mfnode values.  Every copy adds (and
+// every destruction releases) a reference to each node in the vector; so
+// this is dominated by the cost of node reference counting.
+//
+// Usage: bench-mfnode-copy [node-count [iterations]]
+//
+
+# include <algorithm>
+# include <cstdlib>
+# include <iostream>
+# include <sstream>
+# include <boost/date_time/posix_time/posix_time_types.hpp>
+# include <boost/lexical_cast.hpp>
+# include "test_resource_fetcher.h"
+
+using namespace std;
+using namespace openvrml;
+
+int main(int argc, char * argv[])
+{
+    using boost::lexical_cast;
+    using boost::posix_time::microsec_clock;
+    using boost::posix_time::ptime;
+
+    const size_t node_count =
+        (argc > 1) ? lexical_cast<size_t>(argv[1]) : 100000;
+    const size_t iterations =
+        (argc > 2) ? lexical_cast<size_t>(argv[2]) : 100;
+
+    test_resource_fetcher fetcher;
+    browser b(fetcher, std::cout, std::cerr);
+
+    //
+    // Create the nodes in batches; a single stream with a very large number
+    // of top-level statements can exhaust the parser's stack.
+    //
+    static const size_t batch_size = 10000;
+    mfnode::value_type nodes;
+    nodes.reserve(node_count);
+    while (nodes.size() < node_count) {
+        const size_t n = std::min(batch_size, node_count - nodes.size());
+        stringstream vrmlstream;
+        for (size_t i = 0; i < n; ++i) { vrmlstream << "Group {}\n"; }
+        const mfnode::value_type batch =
+            b.create_vrml_from_stream(vrmlstream);
+        if (batch.size() != n) {
+            cerr << argv[0] << ": expected " << n << " nodes; got "
+                 << batch.size() << endl;
+            return EXIT_FAILURE;
+        }
+        nodes.insert(nodes.end(), batch.begin(), batch.end());
+    }
+    const mfnode children(nodes);
+    nodes.clear();
+
+    const ptime start = microsec_clock::universal_time();
+    size_t total = 0;
+    for (size_t i = 0; i < iterations; ++i) {
+        const mfnode::value_type copy = children.value();
+        total += copy.size();
+    }
+    const ptime stop = microsec_clock::universal_time();
+
+    const double seconds = (stop - start).total_microseconds() / 1.0e6;
+    cout << "copied " << iterations << " x " << node_count << " nodes in "
+         << seconds << " s ("
+         << (seconds > 0.0 ? total / seconds : 0.0) << " nodes/s)" << endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,207 @@
+// -*- mode: c++; indent-tabs-mode: nil; c-basic-offset: 4; fill-column: 78 -*-
+//
+// Copyright 2026  Braden McDaniel
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation; either version 3 of the License, or (at your option)
+// any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this library; if not, see <http://www.gnu.org/licenses/>.
+//
+
+//
+// Measure the cost of rendering a world with a large number of DEF'd
+// Transforms.  Each grouping node passes its name to viewer::begin_object
+// on every frame; so this is sensitive to the cost of node::id.
+//
+// Usage: bench-render-def [transform-count [frames]]
+//
+
+# include <cstdlib>
+# include <iostream>
+# include <sstream>
+# include <boost/date_time/posix_time/posix_time_types.hpp>
+# include <boost/lexical_cast.hpp>
+# include <openvrml/viewer.h>
+# include "test_resource_fetcher.h"
+
+using namespace std;
+using namespace openvrml;
+
+namespace {
+
+    //
+    // A viewer that draws nothing; it just records the objects it is asked
+    // to begin.
+    //
+    class recording_viewer : public viewer {
+    public:
+        size_t objects;
+        size_t named_objects;
+
+        recording_viewer():
+            objects(0),
+            named_objects(0)
+        {}
+
+        virtual ~recording_viewer() OPENVRML_NOTHROW
+        {}
+
+    private:
+        virtual bounding_volume::intersection
+        do_intersect_view_volume(const bounding_volume &) const
+        {
+            return bounding_volume::inside;
+        }
+
+        virtual rendering_mode do_mode() { return draw_mode; }
+        virtual double do_frame_rate() { return 0.0; }
+        virtual void do_reset_user_navigation() {}
+
+        virtual void do_begin_object(const char * id, bool)
+        {
+            ++this->objects;
+            if (id && *id) { ++this->named_objects; }
+        }
+
+        virtual void do_end_object() {}
+        virtual void do_insert_background(const background_node &) {}
+        virtual void do_insert_box(const geometry_node &, const vec3f &) {}
+        virtual void do_insert_cone(const geometry_node &, float, float,
+                                    bool, bool)
+        {}
+        virtual void do_insert_cylinder(const geometry_node &, float, float,
+                                        bool, bool, bool)
+        {}
+        virtual void
+        do_insert_elevation_grid(const geometry_node &, unsigned int,
+                                 const std::vector<float> &, int32, int32,
+                                 float, float, const std::vector<color> &,
+                                 const std::vector<vec3f> &,
+                                 const std::vector<vec2f> &)
+        {}
+        virtual void do_insert_extrusion(const geometry_node &, unsigned int,
+                                         const std::vector<vec3f> &,
+                                         const std::vector<vec2f> &,
+                                         const std::vector<rotation> &,
+                                         const std::vector<vec2f> &)
+        {}
+        virtual void do_insert_line_set(const geometry_node &,
+                                        const std::vector<vec3f> &,
+                                        const std::vector<int32> &, bool,
+                                        const std::vector<color> &,
+                                        const std::vector<int32> &)
+        {}
+        virtual void do_insert_point_set(const geometry_node &,
+                                         const std::vector<vec3f> &,
+                                         const std::vector<color> &)
+        {}
+        virtual void do_insert_shell(const geometry_node &, unsigned int,
+                                     const std::vector<vec3f> &,
+                                     const std::vector<int32> &,
+                                     const std::vector<color> &,
+                                     const std::vector<int32> &,
+                                     const std::vector<vec3f> &,
+                                     const std::vector<int32> &,
+                                     const std::vector<vec2f> &,
+                                     const std::vector<int32> &)
+        {}
+        virtual void do_insert_sphere(const geometry_node &, float) {}
+        virtual void do_insert_dir_light(float, float, const color &,
+                                         const vec3f &)
+        {}
+        virtual void do_insert_point_light(float, const vec3f &,
+                                           const color &, float,
+                                           const vec3f &, float)
+        {}
+        virtual void do_insert_spot_light(float, const vec3f &, float,
+                                          const color &, float,
+                                          const vec3f &, float,
+                                          const vec3f &, float)
+        {}
+        virtual void do_remove_object(const node &) {}
+        virtual void do_enable_lighting(bool) {}
+        virtual void do_set_fog(const color &, float, const char *) {}
+        virtual void do_set_color(const color &, float) {}
+        virtual void do_set_material(float, const color &, const color &,
+                                     float, const color &, float)
+        {}
+        virtual void do_set_material_mode(size_t, bool) {}
+        virtual void do_set_sensitive(node *) {}
+        virtual void do_insert_texture(const texture_node &, bool) {}
+        virtual void do_remove_texture_object(const texture_node &) {}
+        virtual void do_set_texture_transform(const vec2f &, float,
+                                              const vec2f &, const vec2f &)
+        {}
+        virtual void do_set_frustum(float, float, float) {}
+        virtual void do_set_viewpoint(const vec3f &, const rotation &,
+                                      float, float)
+        {}
+        virtual void do_transform(const mat4f &) {}
+        virtual void do_transform_points(size_t, vec3f *) const {}
+        virtual void
+        do_draw_bounding_sphere(const bounding_sphere &,
+                                bounding_volume::intersection)
+        {}
+    };
+}
+
+int main(int argc, char * argv[])
+{
+    using boost::lexical_cast;
+    using boost::posix_time::microsec_clock;
+    using boost::posix_time::ptime;
+
+    const size_t transform_count =
+        (argc > 1) ? lexical_cast<size_t>(argv[1]) : 50000;
+    const size_t frames = (argc > 2) ? lexical_cast<size_t>(argv[2]) : 10;
+
+    test_resource_fetcher fetcher;
+    browser b(fetcher, std::cout, std::cerr);
+
+    //
+    // All of the Transforms are children of a single Group so that their
+    // names all end up in the same scope.
+    //
+    stringstream vrmlstream;
+    vrmlstream << "Group { children [\n";
+    for (size_t i = 0; i < transform_count; ++i) {
+        vrmlstream << "DEF T" << i << " Transform { children Group {} }\n";
+    }
+    vrmlstream << "] }\n";
+    b.replace_world(b.create_vrml_from_stream(vrmlstream));
+
+    recording_viewer v;
+    b.viewer(&v);
+
+    mat4f modelview = make_mat4f();
+    rendering_context context(bounding_volume::partial, modelview);
+    const ptime start = microsec_clock::universal_time();
+    for (size_t i = 0; i < frames; ++i) { b.render(context); }
+    const ptime stop = microsec_clock::universal_time();
+    b.viewer(0);
+
+    //
+    // Transform begins an object for itself and another for its children;
+    // both carry its name.
+    //
+    if (v.named_objects != 2 * transform_count * frames) {
+        cerr << argv[0] << ": expected " << 2 * transform_count * frames
+             << " named objects; got " << v.named_objects << endl;
+        return EXIT_FAILURE;
+    }
+
+    const double seconds = (stop - start).total_microseconds() / 1.0e6;
+    cout << "rendered " << frames << " frames of " << transform_count
+         << " DEF'd Transforms in " << seconds << " s ("
+         << (seconds > 0.0 ? seconds / frames : 0.0) << " s/frame)" << endl;
+
+    return EXIT_SUCCESS;
+}
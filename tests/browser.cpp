@@ -26,6 +26,7 @@
 # include <boost/scope_exit.hpp>
 # include <boost/thread.hpp>
 # include <boost/test/unit_test.hpp>
+# include <openvrml/scene.h>
 # include "test_resource_fetcher.h"
 
 using namespace std;
@@ -72,6 +73,38 @@ BOOST_AUTO_TEST_CASE(create_vrml_from_stream_with_externproto)
     BOOST_CHECK_EQUAL(nodes[0]->type().id(), "Node");
 }
 
+BOOST_AUTO_TEST_CASE(scene_load_from_file_reports_error_position)
+{
+    {
+        ofstream file("test.wrl");
+        file << "#VRML V2.0 utf8" << endl
+             << "Group {\r\n"
+             << "\tchildren Foo {}" << endl
+             << "}" << endl;
+    }
+    BOOST_SCOPE_EXIT() {
+        remove(boost::filesystem::path("test.wrl"));
+    } BOOST_SCOPE_EXIT_END
+
+    test_resource_fetcher fetcher;
+    browser b(fetcher, std::cout, std::cerr);
+
+    const string url = "file://"
+        + (boost::filesystem::current_path() / "test.wrl").string();
+    const std::auto_ptr<resource_istream> in = fetcher.get_resource(url);
+    BOOST_REQUIRE(*in);
+
+    scene s(b);
+    try {
+        s.load(*in);
+        BOOST_ERROR("expected invalid_vrml");
+    } catch (const invalid_vrml & ex) {
+        BOOST_CHECK_EQUAL(ex.url, url);
+        BOOST_CHECK_EQUAL(ex.line, 3U);
+        BOOST_CHECK_EQUAL(ex.column, 14U);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(create_vrml_from_url)
 {
     class children_listener : public openvrml::mfnode_listener {
@@ -146,3 +179,213 @@ BOOST_AUTO_TEST_CASE(create_vrml_from_url)
     BOOST_REQUIRE(children.size() == 1);
     BOOST_CHECK_EQUAL(children[0]->type().id(), "Shape");
 }
+
+namespace {
+
+    class counting_listener : public sfvec3f_listener {
+    public:
+        size_t events;
+
+        counting_listener():
+            events(0)
+        {}
+
+        virtual ~counting_listener() OPENVRML_NOTHROW
+        {}
+
+    protected:
+        virtual void do_process_event(const sfvec3f &, double)
+            OPENVRML_THROW1(std::bad_alloc)
+        {
+            ++this->events;
+        }
+    };
+
+    //
+    // On its first event, replaces itself on the emitter with another
+    // listener.
+    //
+    class replacing_listener : public counting_listener {
+        sfvec3f_emitter & emitter_;
+        sfvec3f_listener * replacement_;
+
+    public:
+        replacing_listener(sfvec3f_emitter & emitter,
+                           sfvec3f_listener & replacement):
+            emitter_(emitter),
+            replacement_(&replacement)
+        {}
+
+        virtual ~replacing_listener() OPENVRML_NOTHROW
+        {}
+
+    private:
+        virtual void do_process_event(const sfvec3f & value,
+                                      const double timestamp)
+            OPENVRML_THROW1(std::bad_alloc)
+        {
+            this->counting_listener::do_process_event(value, timestamp);
+            if (this->replacement_) {
+                this->emitter_.remove(*this);
+                this->emitter_.add(*this->replacement_);
+                this->replacement_ = 0;
+            }
+        }
+    };
+}
+
+BOOST_AUTO_TEST_CASE(event_cascade_breaks_route_loop)
+{
+    test_resource_fetcher fetcher;
+    browser b(fetcher, std::cout, std::cerr);
+
+    const char vrmlstring[] =
+        "DEF A Transform {}\n"
+        "DEF B Transform {}\n"
+        "ROUTE A.translation_changed TO B.set_translation\n"
+        "ROUTE B.translation_changed TO A.set_translation\n";
+    stringstream vrmlstream(vrmlstring);
+    vector<boost::intrusive_ptr<node> > nodes =
+        b.create_vrml_from_stream(vrmlstream);
+    BOOST_REQUIRE(nodes.size() == 2);
+    b.replace_world(nodes);
+
+    const event_cascade_stats before = b.event_cascade_stats();
+
+    sfvec3f_listener & set_translation =
+        nodes[0]->event_listener<sfvec3f>("set_translation");
+    set_translation.process_event(sfvec3f(make_vec3f(1.0, 2.0, 3.0)),
+                                  browser::current_time());
+
+    const event_cascade_stats after = b.event_cascade_stats();
+    BOOST_CHECK_EQUAL(after.cascades, before.cascades + 1);
+    BOOST_CHECK_EQUAL(after.last_size, 2U);
+    BOOST_CHECK_EQUAL(after.last_depth, 2U);
+    BOOST_CHECK_EQUAL(after.dropped_events, before.dropped_events + 1);
+
+    BOOST_CHECK_EQUAL(nodes[1]->field<sfvec3f>("translation").value(),
+                      make_vec3f(1.0, 2.0, 3.0));
+}
+
+BOOST_AUTO_TEST_CASE(event_cascade_drops_duplicate_timestamp)
+{
+    test_resource_fetcher fetcher;
+    browser b(fetcher, std::cout, std::cerr);
+
+    const char vrmlstring[] =
+        "DEF A Transform {}\n"
+        "DEF B Transform {}\n"
+        "DEF C Transform {}\n"
+        "ROUTE A.translation_changed TO C.set_translation\n"
+        "ROUTE B.translation_changed TO C.set_translation\n";
+    stringstream vrmlstream(vrmlstring);
+    vector<boost::intrusive_ptr<node> > nodes =
+        b.create_vrml_from_stream(vrmlstream);
+    BOOST_REQUIRE(nodes.size() == 3);
+    b.replace_world(nodes);
+
+    const event_cascade_stats before = b.event_cascade_stats();
+
+    //
+    // Two cascades with the same timestamp: C.translation_changed may only
+    // be emitted by the first.
+    //
+    const double timestamp = browser::current_time();
+    nodes[0]->event_listener<sfvec3f>("set_translation")
+        .process_event(sfvec3f(make_vec3f(1.0, 0.0, 0.0)), timestamp);
+    nodes[1]->event_listener<sfvec3f>("set_translation")
+        .process_event(sfvec3f(make_vec3f(2.0, 0.0, 0.0)), timestamp);
+
+    const event_cascade_stats after = b.event_cascade_stats();
+    BOOST_CHECK_EQUAL(after.cascades, before.cascades + 2);
+    BOOST_CHECK_EQUAL(after.events, before.events + 3);
+    BOOST_CHECK_EQUAL(after.dropped_events, before.dropped_events + 1);
+    BOOST_CHECK_EQUAL(after.last_size, 1U);
+}
+
+BOOST_AUTO_TEST_CASE(modify_listeners_during_dispatch)
+{
+    test_resource_fetcher fetcher;
+    browser b(fetcher, std::cout, std::cerr);
+
+    stringstream vrmlstream("DEF A Transform {}");
+    vector<boost::intrusive_ptr<node> > nodes =
+        b.create_vrml_from_stream(vrmlstream);
+    BOOST_REQUIRE(nodes.size() == 1);
+    b.replace_world(nodes);
+
+    sfvec3f_emitter & translation_changed =
+        nodes[0]->event_emitter<sfvec3f>("translation_changed");
+    sfvec3f_listener & set_translation =
+        nodes[0]->event_listener<sfvec3f>("set_translation");
+
+    counting_listener other, replacement;
+    replacing_listener replacing(translation_changed, replacement);
+    BOOST_REQUIRE(translation_changed.add(replacing));
+    BOOST_REQUIRE(translation_changed.add(other));
+
+    //
+    // The event being dispatched when the listeners change still goes to
+    // the listeners that were registered when it was emitted.
+    //
+    const double timestamp = browser::current_time();
+    set_translation.process_event(sfvec3f(make_vec3f(1.0, 0.0, 0.0)),
+                                  timestamp);
+    BOOST_CHECK_EQUAL(replacing.events, 1U);
+    BOOST_CHECK_EQUAL(other.events, 1U);
+    BOOST_CHECK_EQUAL(replacement.events, 0U);
+
+    const set<sfvec3f_listener *> listeners = translation_changed.listeners();
+    BOOST_CHECK_EQUAL(listeners.size(), 2U);
+    BOOST_CHECK(listeners.find(&replacing) == listeners.end());
+    BOOST_CHECK(listeners.find(&other) != listeners.end());
+    BOOST_CHECK(listeners.find(&replacement) != listeners.end());
+
+    set_translation.process_event(sfvec3f(make_vec3f(2.0, 0.0, 0.0)),
+                                  timestamp + 1.0);
+    BOOST_CHECK_EQUAL(replacing.events, 1U);
+    BOOST_CHECK_EQUAL(other.events, 2U);
+    BOOST_CHECK_EQUAL(replacement.events, 1U);
+
+    translation_changed.remove(other);
+    translation_changed.remove(replacement);
+}
+
+BOOST_AUTO_TEST_CASE(delete_route_stops_delivery)
+{
+    test_resource_fetcher fetcher;
+    browser b(fetcher, std::cout, std::cerr);
+
+    const char vrmlstring[] =
+        "DEF A Transform {}\n"
+        "DEF B Transform {}\n"
+        "ROUTE A.translation_changed TO B.set_translation\n";
+    stringstream vrmlstream(vrmlstring);
+    vector<boost::intrusive_ptr<node> > nodes =
+        b.create_vrml_from_stream(vrmlstream);
+    BOOST_REQUIRE(nodes.size() == 2);
+    b.replace_world(nodes);
+
+    sfvec3f_listener & set_translation =
+        nodes[0]->event_listener<sfvec3f>("set_translation");
+    const double timestamp = browser::current_time();
+
+    set_translation.process_event(sfvec3f(make_vec3f(1.0, 0.0, 0.0)),
+                                  timestamp);
+    BOOST_CHECK_EQUAL(nodes[1]->field<sfvec3f>("translation").value(),
+                      make_vec3f(1.0, 0.0, 0.0));
+
+    BOOST_REQUIRE(delete_route(*nodes[0], "translation_changed",
+                               *nodes[1], "set_translation"));
+    set_translation.process_event(sfvec3f(make_vec3f(2.0, 0.0, 0.0)),
+                                  timestamp + 1.0);
+    BOOST_CHECK_EQUAL(nodes[1]->field<sfvec3f>("translation").value(),
+                      make_vec3f(1.0, 0.0, 0.0));
+
+    BOOST_REQUIRE(add_route(*nodes[0], "translation_changed",
+                            *nodes[1], "set_translation"));
+    set_translation.process_event(sfvec3f(make_vec3f(3.0, 0.0, 0.0)),
+                                  timestamp + 2.0);
+    BOOST_CHECK_EQUAL(nodes[1]->field<sfvec3f>("translation").value(),
+                      make_vec3f(3.0, 0.0, 0.0));
+}
@@ -0,0 +1,69 @@
+// -*- mode: c++; indent-tabs-mode: nil; c-basic-offset: 4; fill-column: 78 -*-
+//
+// Copyright 2026  Braden McDaniel
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation; either version 3 of the License, or (at your option)
+// any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this library; if not, see <http://www.gnu.org/licenses/>.
+//
+
+# define BOOST_TEST_MAIN
+# define BOOST_TEST_MODULE field_value
+
+# include <boost/test/unit_test.hpp>
+# include <openvrml/field_value.h>
+
+using namespace std;
+using namespace openvrml;
+
+BOOST_AUTO_TEST_CASE(take_value_does_not_copy)
+{
+    vector<vec3f> val(1000, make_vec3f(1.0, 2.0, 3.0));
+    const vec3f * const data = &val.front();
+
+    mfvec3f mfv;
+    mfv.take_value(val);
+
+    BOOST_CHECK(val.empty());
+    BOOST_REQUIRE_EQUAL(mfv.value().size(), 1000U);
+    BOOST_CHECK_EQUAL(&mfv.value().front(), data);
+}
+
+BOOST_AUTO_TEST_CASE(take_value_leaves_copies_unchanged)
+{
+    mfint32 mfi(3, 7);
+    const mfint32 before(mfi);
+
+    vector<int32> val(2, 42);
+    mfi.take_value(val);
+
+    const mfint32 after(mfi);
+
+    BOOST_REQUIRE_EQUAL(before.value().size(), 3U);
+    BOOST_CHECK_EQUAL(before.value()[0], 7);
+    BOOST_REQUIRE_EQUAL(after.value().size(), 2U);
+    BOOST_CHECK_EQUAL(after.value()[0], 42);
+    BOOST_CHECK_EQUAL(&after.value().front(), &mfi.value().front());
+}
+
+BOOST_AUTO_TEST_CASE(assign_shares_taken_value)
+{
+    vector<string> val(2, "foo");
+    mfstring taken;
+    taken.take_value(val);
+
+    mfstring target;
+    target.assign(taken);
+
+    BOOST_REQUIRE_EQUAL(target.value().size(), 2U);
+    BOOST_CHECK_EQUAL(&target.value().front(), &taken.value().front());
+}
@@ -0,0 +1,331 @@
+// -*- mode: c++; indent-tabs-mode: nil; c-basic-offset: 4; fill-column: 78 -*-
+//
+// Copyright 2026  Braden McDaniel
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation; either version 3 of the License, or (at your option)
+// any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this library; if not, see <http://www.gnu.org/licenses/>.
+//
+
+# define BOOST_TEST_MAIN
+# define BOOST_TEST_MODULE node
+
+# include <iostream>
+# include <limits>
+# include <sstream>
+# include <boost/test/unit_test.hpp>
+# include <openvrml/scene.h>
+# include <openvrml/scope.h>
+# include "test_resource_fetcher.h"
+
+using namespace std;
+using namespace openvrml;
+
+namespace {
+
+    const vector<boost::intrusive_ptr<node> >
+    create_nodes(browser & b, const char * vrmlstring)
+    {
+        stringstream vrmlstream(vrmlstring);
+        return b.create_vrml_from_stream(vrmlstream);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(unnamed_node_id_is_empty)
+{
+    test_resource_fetcher fetcher;
+    browser b(fetcher, std::cout, std::cerr);
+
+    const vector<boost::intrusive_ptr<node> > nodes =
+        create_nodes(b, "Group {}");
+    BOOST_REQUIRE(nodes.size() == 1);
+    BOOST_CHECK_EQUAL(nodes[0]->id(), "");
+}
+
+BOOST_AUTO_TEST_CASE(def_node_id)
+{
+    test_resource_fetcher fetcher;
+    browser b(fetcher, std::cout, std::cerr);
+
+    const vector<boost::intrusive_ptr<node> > nodes =
+        create_nodes(b, "DEF A Group {}");
+    BOOST_REQUIRE(nodes.size() == 1);
+    BOOST_CHECK_EQUAL(nodes[0]->id(), "A");
+    BOOST_CHECK_EQUAL(nodes[0]->scope().find_node("A"), nodes[0].get());
+}
+
+BOOST_AUTO_TEST_CASE(rename_node)
+{
+    test_resource_fetcher fetcher;
+    browser b(fetcher, std::cout, std::cerr);
+
+    const vector<boost::intrusive_ptr<node> > nodes =
+        create_nodes(b, "DEF A Group {}");
+    BOOST_REQUIRE(nodes.size() == 1);
+
+    nodes[0]->id("B");
+    BOOST_CHECK_EQUAL(nodes[0]->id(), "B");
+    BOOST_CHECK(!nodes[0]->scope().find_node("A"));
+    BOOST_CHECK_EQUAL(nodes[0]->scope().find_node("B"), nodes[0].get());
+}
+
+BOOST_AUTO_TEST_CASE(reuse_node_id)
+{
+    test_resource_fetcher fetcher;
+    browser b(fetcher, std::cout, std::cerr);
+
+    const vector<boost::intrusive_ptr<node> > nodes =
+        create_nodes(b, "DEF A Group {} Group {}");
+    BOOST_REQUIRE(nodes.size() == 2);
+
+    nodes[1]->id("A");
+    BOOST_CHECK_EQUAL(nodes[0]->id(), "");
+    BOOST_CHECK_EQUAL(nodes[1]->id(), "A");
+    BOOST_CHECK_EQUAL(nodes[1]->scope().find_node("A"), nodes[1].get());
+
+    //
+    // Renaming the node that lost its name must not disturb the new owner.
+    //
+    nodes[0]->id("B");
+    BOOST_CHECK_EQUAL(nodes[1]->scope().find_node("A"), nodes[1].get());
+    BOOST_CHECK_EQUAL(nodes[1]->scope().find_node("B"), nodes[0].get());
+}
+
+BOOST_AUTO_TEST_CASE(destroy_named_node)
+{
+    test_resource_fetcher fetcher;
+    browser b(fetcher, std::cout, std::cerr);
+
+    vector<boost::intrusive_ptr<node> > nodes =
+        create_nodes(b, "DEF A Group {} Group {}");
+    BOOST_REQUIRE(nodes.size() == 2);
+
+    //
+    // The second node keeps the scope alive.
+    //
+    const boost::intrusive_ptr<node> survivor = nodes[1];
+    const scope & s = survivor->scope();
+    BOOST_REQUIRE_EQUAL(s.find_node("A"), nodes[0].get());
+
+    nodes.clear();
+    BOOST_CHECK(!s.find_node("A"));
+}
+
+BOOST_AUTO_TEST_CASE(intern_symbol)
+{
+    const symbol a("intern_symbol_test");
+    const symbol b("intern_symbol_test");
+    BOOST_CHECK(a == b);
+    BOOST_CHECK_EQUAL(a.id(), b.id());
+    BOOST_CHECK_EQUAL(a.name(), "intern_symbol_test");
+    BOOST_CHECK(a != symbol("intern_symbol_test2"));
+
+    BOOST_CHECK(symbol().empty());
+    BOOST_CHECK_EQUAL(symbol().id(), 0U);
+    BOOST_CHECK(symbol("") == symbol());
+
+    BOOST_CHECK(symbol::find("intern_symbol_test") == a);
+    BOOST_CHECK(symbol::find("intern_symbol_never_interned").empty());
+}
+
+BOOST_AUTO_TEST_CASE(symbol_interface_lookup)
+{
+    test_resource_fetcher fetcher;
+    browser b(fetcher, std::cout, std::cerr);
+
+    const vector<boost::intrusive_ptr<node> > nodes =
+        create_nodes(b, "Transform { translation 1 2 3 }");
+    BOOST_REQUIRE(nodes.size() == 1);
+    node & n = *nodes[0];
+
+    BOOST_CHECK_EQUAL(n.field<sfvec3f>(symbol("translation")).value(),
+                      make_vec3f(1, 2, 3));
+
+    event_listener & set_translation =
+        n.event_listener(symbol("set_translation"));
+    BOOST_CHECK_EQUAL(&n.event_listener(symbol("translation")),
+                      &set_translation);
+    BOOST_CHECK_EQUAL(&n.event_listener("translation"), &set_translation);
+    BOOST_CHECK_EQUAL(
+        dynamic_cast<node_event_listener &>(set_translation).eventin_id(),
+        "set_translation");
+
+    event_emitter & translation_changed =
+        n.event_emitter(symbol("translation_changed"));
+    BOOST_CHECK_EQUAL(&n.event_emitter(symbol("translation")),
+                      &translation_changed);
+    BOOST_CHECK_EQUAL(translation_changed.eventout_id(),
+                      "translation_changed");
+
+    BOOST_CHECK_THROW(n.event_listener(symbol("no_such_eventin")),
+                      unsupported_interface);
+    BOOST_CHECK_THROW(n.event_emitter("no_such_eventout_never_interned"),
+                      unsupported_interface);
+}
+
+BOOST_AUTO_TEST_CASE(add_route_by_symbol)
+{
+    test_resource_fetcher fetcher;
+    browser b(fetcher, std::cout, std::cerr);
+
+    const vector<boost::intrusive_ptr<node> > nodes =
+        create_nodes(b, "TimeSensor {} PositionInterpolator {}");
+    BOOST_REQUIRE(nodes.size() == 2);
+
+    const symbol fraction_changed("fraction_changed");
+    const symbol set_fraction("set_fraction");
+    BOOST_CHECK(add_route(*nodes[0], fraction_changed,
+                          *nodes[1], set_fraction));
+    BOOST_CHECK(!add_route(*nodes[0], fraction_changed,
+                           *nodes[1], set_fraction));
+    BOOST_CHECK(delete_route(*nodes[0], fraction_changed,
+                             *nodes[1], set_fraction));
+    BOOST_CHECK(!delete_route(*nodes[0], fraction_changed,
+                              *nodes[1], set_fraction));
+}
+
+BOOST_AUTO_TEST_CASE(modified_propagates_to_ancestors)
+{
+    test_resource_fetcher fetcher;
+    browser b(fetcher, std::cout, std::cerr);
+
+    const vector<boost::intrusive_ptr<node> > nodes =
+        create_nodes(b,
+                     "Group { children DEF T Transform { children Shape {} } }"
+                     " Group { children USE T }"
+                     " Group {}");
+    BOOST_REQUIRE(nodes.size() == 3);
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        nodes[i]->initialize(*b.root_scene(), 0.0);
+    }
+
+    const boost::intrusive_ptr<node> transform =
+        nodes[0]->scope().find_node("T");
+    BOOST_REQUIRE(transform);
+    const boost::intrusive_ptr<node> shape =
+        transform->field<mfnode>("children").value().at(0);
+
+    const boost::intrusive_ptr<node> all[] =
+        { nodes[0], nodes[1], nodes[2], transform, shape };
+    const size_t all_count = sizeof all / sizeof all[0];
+
+    for (size_t i = 0; i < all_count; ++i) { all[i]->modified(false); }
+    shape->modified(true);
+    BOOST_CHECK(transform->modified());
+    BOOST_CHECK(nodes[0]->modified());
+    BOOST_CHECK(nodes[1]->modified());
+    BOOST_CHECK(!nodes[2]->modified());
+
+    //
+    // Changes do not propagate downward.
+    //
+    for (size_t i = 0; i < all_count; ++i) { all[i]->modified(false); }
+    nodes[0]->modified(true);
+    BOOST_CHECK(!transform->modified());
+    BOOST_CHECK(!shape->modified());
+    BOOST_CHECK(!nodes[1]->modified());
+
+    //
+    // Moving the Transform from the first Group to the third moves its
+    // parent link.
+    //
+    const mfnode moved(vector<boost::intrusive_ptr<node> >(1, transform));
+    nodes[0]->event_listener<mfnode>("removeChildren")
+        .process_event(moved, 1.0);
+    nodes[2]->event_listener<mfnode>("addChildren")
+        .process_event(moved, 1.0);
+
+    for (size_t i = 0; i < all_count; ++i) { all[i]->modified(false); }
+    shape->modified(true);
+    BOOST_CHECK(!nodes[0]->modified());
+    BOOST_CHECK(nodes[1]->modified());
+    BOOST_CHECK(nodes[2]->modified());
+
+    //
+    // Replacing the second Group's children through the exposedField
+    // unlinks the Transform.
+    //
+    nodes[1]->event_listener<mfnode>("set_children").process_event(mfnode(),
+                                                                   2.0);
+    for (size_t i = 0; i < all_count; ++i) { all[i]->modified(false); }
+    shape->modified(true);
+    BOOST_CHECK(!nodes[1]->modified());
+    BOOST_CHECK(nodes[2]->modified());
+}
+
+BOOST_AUTO_TEST_CASE(scene_bounding_volume_follows_changes)
+{
+    test_resource_fetcher fetcher;
+    browser b(fetcher, std::cout, std::cerr);
+
+    scene s(b);
+    s.nodes(create_nodes(b,
+                         "Group {"
+                         "  children DEF T Transform {"
+                         "    children Shape { geometry Box {} }"
+                         "  }"
+                         "}"));
+    s.initialize(0.0);
+
+    const bounding_sphere & before =
+        dynamic_cast<const bounding_sphere &>(s.bounding_volume());
+    BOOST_CHECK_SMALL(before.center().length(), 1e-5f);
+    const float radius = before.radius();
+    BOOST_CHECK(radius > 0.0f);
+
+    const boost::intrusive_ptr<node> transform =
+        s.nodes().front()->scope().find_node("T");
+    BOOST_REQUIRE(transform);
+    transform->event_listener<sfvec3f>("set_translation")
+        .process_event(sfvec3f(make_vec3f(10, 0, 0)), 1.0);
+
+    const bounding_sphere & after =
+        dynamic_cast<const bounding_sphere &>(s.bounding_volume());
+    BOOST_CHECK_CLOSE(after.center().x(), 10.0f, 1e-3f);
+    BOOST_CHECK_CLOSE(after.radius(), radius, 1e-3f);
+
+    s.shutdown(2.0);
+}
+
+BOOST_AUTO_TEST_CASE(idle_time_sensor_sleeps_until_start_time)
+{
+    test_resource_fetcher fetcher;
+    browser b(fetcher, std::cout, std::cerr);
+
+    const vector<boost::intrusive_ptr<node> > nodes =
+        create_nodes(b, "TimeSensor { startTime 100 cycleInterval 10 }");
+    BOOST_REQUIRE(nodes.size() == 1);
+    nodes[0]->initialize(*b.root_scene(), 1.0);
+
+    BOOST_CHECK_EQUAL(b.next_wakeup_time(), 100.0);
+    b.update(50.0);
+    BOOST_CHECK_EQUAL(b.next_wakeup_time(), 100.0);
+
+    //
+    // Active: due on every update.
+    //
+    b.update(100.0);
+    BOOST_CHECK(b.next_wakeup_time() <= 100.0);
+
+    //
+    // Finished its cycle; nothing to do until startTime is set again.
+    //
+    b.update(111.0);
+    BOOST_CHECK_EQUAL(b.next_wakeup_time(),
+                      numeric_limits<double>::infinity());
+
+    nodes[0]->event_listener<sftime>("set_startTime")
+        .process_event(sftime(200.0), 150.0);
+    BOOST_CHECK_EQUAL(b.next_wakeup_time(), 200.0);
+
+    nodes[0]->shutdown(300.0);
+}
@@ -19,15 +19,57 @@
 # include <iostream>
 # include <fstream>
 # include <openvrml/x3d_vrml_grammar.h>
+# include <boost/interprocess/file_mapping.hpp>
+# include <boost/interprocess/mapped_region.hpp>
 
 using namespace std;
 using namespace boost::spirit::classic;
 using namespace openvrml;
 
+namespace {
+
+    template <typename Iterator>
+    bool parse_vrml(Iterator first, const Iterator & last)
+    {
+        vrml97_skip_grammar skip_g;
+        //
+        // The grammar holds references to its actions and error handler.
+        //
+        null_x3d_vrml_parse_actions actions;
+        x3d_vrml_parse_error_handler handler;
+        x3d_vrml_grammar<> g(actions, handler);
+
+        BOOST_SPIRIT_DEBUG_NODE(skip_g);
+        BOOST_SPIRIT_DEBUG_NODE(g);
+
+        return parse(first, last, g, skip_g).full;
+    }
+}
+
 int main(int argc, char * argv[])
 {
+    using boost::interprocess::file_mapping;
+    using boost::interprocess::mapped_region;
+    using boost::interprocess::read_only;
+
     ifstream infile;
     if (argc > 1) {
+        //
+        // Parse a file in place if it can be mapped; an empty file cannot
+        // be.
+        //
+        const string filename(argv[1]);
+        try {
+            const file_mapping file(argv[1], read_only);
+            const mapped_region region(file, read_only);
+            const char * const begin =
+                static_cast<const char *>(region.get_address());
+            const char * const end = begin + region.get_size();
+            const buffer_position_iterator first(begin, begin, filename),
+                last(begin, end, filename);
+            return parse_vrml(first, last) ? EXIT_SUCCESS : EXIT_FAILURE;
+        } catch (const boost::interprocess::interprocess_exception &) {}
+
         infile.open(argv[1]);
         if (!infile.is_open()) {
             cerr << argv[0] << ": could not open file \"" << argv[1] << endl;
@@ -47,16 +89,7 @@ int main(int argc, char * argv[])
 
     typedef position_iterator<multi_pass_iterator_t> iterator_t;
 
-    iterator_t first(in_begin, in_end, filename), last;
-
-    vrml97_skip_grammar skip_g;
-    x3d_vrml_grammar<> g;
-
-    BOOST_SPIRIT_DEBUG_NODE(skip_g);
-    BOOST_SPIRIT_DEBUG_NODE(g);
-
-    if (!parse(first, last, g, skip_g).full) {
-        return EXIT_FAILURE;
-    }
-    return EXIT_SUCCESS;
+    return parse_vrml(iterator_t(in_begin, in_end, filename), iterator_t())
+        ? EXIT_SUCCESS
+        : EXIT_FAILURE;
 }
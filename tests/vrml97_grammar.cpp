@@ -0,0 +1,98 @@
+// -*- mode: c++; indent-tabs-mode: nil; c-basic-offset: 4; fill-column: 78 -*-
+//
+// Copyright 2026  Braden McDaniel
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation; either version 3 of the License, or (at your option)
+// any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this library; if not, see <http://www.gnu.org/licenses/>.
+//
+
+# define BOOST_TEST_MAIN
+# define BOOST_TEST_MODULE vrml97_grammar
+
+# include <sstream>
+# include <boost/test/unit_test.hpp>
+# include <openvrml/vrml97_grammar.h>
+
+using namespace std;
+using namespace openvrml;
+
+namespace {
+
+    typedef bulk_element_scanner<
+        boost::spirit::classic::functor_parser<vec3f_parser> >
+        vec3f_scanner;
+
+    //
+    // Enough vec3f values, one per line, for four pieces.
+    //
+    const string vec3f_run(const size_t lines = 60000)
+    {
+        ostringstream out;
+        for (size_t i = 0; i < lines; ++i) {
+            out << i << ".25 -" << i % 7 << "e-1 " << i % 13 << ".5,";
+            if (i % 1000 == 0) { out << " # comment [ ]"; }
+            out << '\n';
+        }
+        out << "]";
+        return out.str();
+    }
+}
+
+BOOST_AUTO_TEST_CASE(bulk_scan_pieces_matches_bulk_scan_run)
+{
+    const string run = vec3f_run();
+    const char * const first = run.data();
+    const char * const last = first + run.size();
+
+    vector<vec3f> expected;
+    const char * const expected_stop =
+        bulk_scan_run<vec3f_scanner>(first, last, expected);
+
+    vector<vec3f> values;
+    const char * const stop =
+        bulk_scan_pieces<vec3f_scanner>(first, last, values, 4);
+
+    BOOST_REQUIRE(stop);
+    BOOST_CHECK_EQUAL(stop - first, expected_stop - first);
+    BOOST_REQUIRE_EQUAL(values.size(), expected.size());
+    BOOST_CHECK(values == expected);
+}
+
+BOOST_AUTO_TEST_CASE(bulk_scan_pieces_declines_small_runs)
+{
+    const string run = vec3f_run(10);
+    vector<vec3f> values;
+    BOOST_CHECK(!bulk_scan_pieces<vec3f_scanner>(run.data(),
+                                                 run.data() + run.size(),
+                                                 values, 4));
+    BOOST_CHECK(values.empty());
+}
+
+BOOST_AUTO_TEST_CASE(bulk_scan_pieces_declines_elements_spanning_lines)
+{
+    //
+    // After the first line, every line break falls after the first
+    // component of an element.
+    //
+    ostringstream out;
+    out << "0.5\n";
+    for (size_t i = 0; i < 60000; ++i) { out << "0.5 0.5 " << i << '\n'; }
+    out << "0.5 0.5 ]";
+    const string run = out.str();
+
+    vector<vec3f> values;
+    BOOST_CHECK(!bulk_scan_pieces<vec3f_scanner>(run.data(),
+                                                 run.data() + run.size(),
+                                                 values, 4));
+    BOOST_CHECK(values.empty());
+}